@@ -0,0 +1,36 @@
+#!/bin/bash
+
+# Compara lanzar muchas tuberías pequeñas desde un bucle de shell con
+# lanzarlas desde un manifiesto con --batch.
+# Uso: bench/batch_bench.sh [tuberías] [trabajos]
+# Cada tubería es cat | wc -l sobre un fichero pequeño. Se ejecutan
+# N veces con un pipex por tubería y después con un único pipex
+# --batch y --jobs=J. Muestra el tiempo de cada modo y comprueba que
+# las salidas coinciden.
+
+N=${1:-1000}
+J=${2:-$(nproc)}
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+make -s -C "$ROOT" > /dev/null
+seq 1 100 > "$TMP/input"
+mkdir "$TMP/loop" "$TMP/batch"
+for ((i = 0; i < N; i++)); do
+	echo "$TMP/input cat 'wc -l' $TMP/batch/$i"
+done > "$TMP/manifest"
+
+start=$(date +%s.%N)
+for ((i = 0; i < N; i++)); do
+	"$ROOT/pipex" "$TMP/input" cat "wc -l" "$TMP/loop/$i"
+done
+mid=$(date +%s.%N)
+"$ROOT/pipex" --batch="$TMP/manifest" --jobs="$J" > /dev/null
+end=$(date +%s.%N)
+
+awk -v n="$N" -v a="$start" -v b="$mid" -v c="$end" -v j="$J" 'BEGIN {
+	printf "  bucle de shell   %8.3f s %8.0f tuberías/s\n", b - a, n / (b - a)
+	printf "  --batch -j%-5d %8.3f s %8.0f tuberías/s\n", j, c - b,
+		n / (c - b) }'
+diff -r "$TMP/loop" "$TMP/batch" > /dev/null || echo "las salidas difieren"
@@ -0,0 +1,63 @@
+#!/bin/bash
+
+# Compara el grep interno de pipex con GNU grep sobre un log grande.
+# Uso: bench/grep_bench.sh [MB] [patrón_ERE...]
+# Genera un log de unos MB megas repitiendo un bloque aleatorio y, para
+# cada patrón, cuenta las líneas con grep -cE dentro de pipex y con
+# --no-builtins (el binario del sistema). Los recuentos deben coincidir.
+
+MB=${1:-2048}
+shift
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+if [ $# -eq 0 ]; then
+	set -- 'ERROR|WARN' 'user=(alice|bob)' 'id=[0-9]{5} ' \
+		'[0-9]+\.[0-9]+\.255\.' 'timeout after [0-9]+s' \
+		'^2024-0[1-3]' '\w+=\w+ \w+=[0-9]+ ip'
+fi
+
+awk 'BEGIN {
+	srand(42)
+	split("INFO INFO INFO DEBUG WARN ERROR", lvl, " ")
+	split("alice bob carol dave eve", usr, " ")
+	for (i = 0; i < 40000; i++)
+		printf "2024-%02d-%02d %02d:%02d:%02d %s user=%s id=%d " \
+			"ip=%d.%d.%d.%d%s\n",
+			int(rand() * 12) + 1, int(rand() * 28) + 1, int(rand() * 24),
+			int(rand() * 60), int(rand() * 60), lvl[int(rand() * 6) + 1],
+			usr[int(rand() * 5) + 1], int(rand() * 200000),
+			int(rand() * 256), int(rand() * 256), int(rand() * 256),
+			int(rand() * 256),
+			(rand() < 0.1) ? " timeout after " int(rand() * 90) "s" : ""
+}' > "$TMP/chunk"
+CHUNK=$(stat -c %s "$TMP/chunk")
+for ((i = 0; i < MB * 1048576 / CHUNK + 1; i++)); do
+	cat "$TMP/chunk"
+done > "$TMP/log"
+SIZE=$(stat -c %s "$TMP/log")
+
+run() {
+	local label=$1 start end
+	shift
+	start=$(date +%s.%N)
+	"$ROOT/pipex" "$@" "$TMP/log" "grep -cE '$PAT'" "cat" "$TMP/$label"
+	end=$(date +%s.%N)
+	awk -v b="$SIZE" -v s="$start" -v e="$end" -v n="$label" \
+		'BEGIN { printf "  %-8s %8.3f s %8.0f MB/s", n, e - s,
+			b / 1048576 / (e - s) }'
+}
+
+make -s -C "$ROOT" > /dev/null
+for PAT in "$@"; do
+	echo "$PAT"
+	run pipex
+	echo "  $(cat "$TMP/pipex") líneas"
+	run gnu --no-builtins
+	if cmp -s "$TMP/pipex" "$TMP/gnu"; then
+		echo "  ok"
+	else
+		echo "  DISTINTO: $(cat "$TMP/gnu") líneas"
+	fi
+done
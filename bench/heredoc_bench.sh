@@ -0,0 +1,33 @@
+#!/bin/bash
+
+# Mide líneas/segundo de here_doc con stdin no interactivo.
+# Uso: bench/heredoc_bench.sh [líneas] [revisión_base]
+# Con una revisión base (p. ej. un commit anterior), la compila en un
+# worktree temporal y compara su binario con el actual.
+
+LINES=${1:-2000000}
+BASE=$2
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"; [ -n "$BASE" ] && git -C "$ROOT" worktree remove --force "$TMP/base" 2>/dev/null' EXIT
+
+seq -f "line %.0f of the here_doc benchmark" "$LINES" > "$TMP/input"
+echo "END" >> "$TMP/input"
+
+run() {
+	local bin=$1 label=$2 start end
+	rm -f "$TMP/out"
+	start=$(date +%s.%N)
+	"$bin" here_doc END "cat" "cat" "$TMP/out" < "$TMP/input" > /dev/null
+	end=$(date +%s.%N)
+	awk -v l="$LINES" -v s="$start" -v e="$end" -v n="$label" \
+		'BEGIN { printf "%-8s %10.3f s %14.0f lines/s\n", n, e - s, l / (e - s) }'
+}
+
+make -s -C "$ROOT" > /dev/null
+if [ -n "$BASE" ]; then
+	git -C "$ROOT" worktree add -q --detach "$TMP/base" "$BASE"
+	make -s -C "$TMP/base" > /dev/null
+	run "$TMP/base/pipex" "before"
+fi
+run "$ROOT/pipex" "after"
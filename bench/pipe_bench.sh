@@ -0,0 +1,43 @@
+#!/bin/bash
+
+# Compara los cambios de contexto de una tubería con distintos tamaños
+# de pipe entre etapas.
+# Uso: bench/pipe_bench.sh [MB] [tamaño...]
+# Genera un fichero de unos MB megas de líneas aleatorias y lo pasa por
+# cat | sort | wc -l con --pipe-size=TAMAÑO (por defecto: los 64 KiB del
+# kernel, 1M y auto). Para cada tamaño muestra el tiempo, los cambios
+# de contexto voluntarios e involuntarios del total de --stats y cuántas
+# veces creció alguna pipe.
+
+MB=${1:-256}
+shift
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+if [ $# -eq 0 ]; then
+	set -- default 1M auto
+fi
+
+head -c $((MB * 786432)) /dev/urandom | base64 > "$TMP/input"
+
+total() {
+	sed 's/.*"total":{//' "$TMP/stats" | grep -o "\"$1\":[0-9]*" \
+		| cut -d: -f2
+}
+
+make -s -C "$ROOT" > /dev/null
+printf "  %-8s %8s %10s %10s %6s\n" tamaño s vcsw ivcsw grows
+for SIZE in "$@"; do
+	OPT=--pipe-size=$SIZE
+	[ "$SIZE" = default ] && OPT=--
+	start=$(date +%s.%N)
+	"$ROOT/pipex" --stats=json --stats-file="$TMP/stats" "$OPT" \
+		"$TMP/input" "cat" "sort" "wc -l" "$TMP/out"
+	end=$(date +%s.%N)
+	awk -v n="$SIZE" -v s="$start" -v e="$end" \
+		-v v="$(total voluntary_ctxt_switches)" \
+		-v i="$(total involuntary_ctxt_switches)" \
+		-v g="$(total pipe_grows)" \
+		'BEGIN { printf "  %-8s %8.3f %10d %10d %6d\n", n, e - s, v, i, g }'
+done
@@ -0,0 +1,43 @@
+#!/bin/bash
+
+# Mide el rendimiento de una tubería de texto de 4 etapas con distintas
+# colocaciones de las etapas en las CPUs.
+# Uso: bench/place_bench.sh [MB] [repeticiones]
+# Genera unos MB megas de texto y lo pasa REP veces por
+# tr | grep -v | tr -s | wc -l con los binarios del sistema, sin
+# colocación, con --pin=compact, con --pin=domain y con --pin=compact
+# más --sched=batch. Muestra el mejor tiempo de cada modo en MB/s.
+
+MB=${1:-512}
+REP=${2:-3}
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+head -c $((MB * 786432)) /dev/urandom | base64 -w 76 \
+	| tr '+/' '  ' > "$TMP/input"
+SIZE=$(stat -c %s "$TMP/input")
+
+run() {
+	local label=$1 best=0 start end i
+	shift
+	for ((i = 0; i < REP; i++)); do
+		start=$(date +%s.%N)
+		"$ROOT/pipex" --no-builtins "$@" -- "$TMP/input" "tr a-z A-Z" \
+			"grep -v QQQ" "tr -s ' '" "wc -l" "$TMP/out"
+		end=$(date +%s.%N)
+		best=$(awk -v b="$best" -v s="$start" -v e="$end" \
+			'BEGIN { t = e - s; if (b == 0 || t < b) b = t; print b }')
+	done
+	awk -v n="$label" -v b="$SIZE" -v t="$best" \
+		'BEGIN { printf "  %-16s %8.3f s %8.0f MB/s\n", n, t,
+			b / 1048576 / t }'
+}
+
+make -s -C "$ROOT" > /dev/null
+echo "$(nproc) CPUs permitidas: $(grep Cpus_allowed_list /proc/self/status \
+	| cut -f2)"
+run ninguna
+run compact --pin=compact
+run domain --pin=domain
+run compact+batch --pin=compact --sched=batch
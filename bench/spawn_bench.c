@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spawn_bench.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:07:53 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/17 23:07:53 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include <linux/sched.h>
+#include <sched.h>
+#include <signal.h>
+#include <spawn.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#define ITERATIONS 200
+#define STACK_SIZE 65536
+
+extern char	**environ;
+
+static char	*g_argv[] = {"/bin/true", NULL};
+
+/**
+ * @brief Child entry point for clone(CLONE_VM | CLONE_VFORK).
+ */
+static int	clone_child(void *arg)
+{
+	(void)arg;
+	execve(g_argv[0], g_argv, environ);
+	_exit(127);
+}
+
+/**
+ * @brief Launches /bin/true with the given backend and returns its pid.
+ *
+ * Backends: 0 fork, 1 vfork, 2 posix_spawn, 3 clone(CLONE_VM|CLONE_VFORK),
+ * 4 clone3 (CLONE_VFORK, copied address space).
+ */
+static pid_t	launch(int backend, char *stack)
+{
+	struct clone_args	args;
+	pid_t				pid;
+
+	if (backend == 2)
+	{
+		if (posix_spawn(&pid, g_argv[0], NULL, NULL, g_argv, environ))
+			return (-1);
+		return (pid);
+	}
+	if (backend == 3)
+		return (clone(clone_child, stack + STACK_SIZE,
+				CLONE_VM | CLONE_VFORK | SIGCHLD, NULL));
+	memset(&args, 0, sizeof(args));
+	args.flags = CLONE_VFORK;
+	args.exit_signal = SIGCHLD;
+	if (backend == 0)
+		pid = fork();
+	else if (backend == 1)
+		pid = vfork();
+	else
+		pid = syscall(SYS_clone3, &args, sizeof(args));
+	if (pid == 0)
+		clone_child(NULL);
+	return (pid);
+}
+
+/**
+ * @brief Returns the mean launch+reap latency of a backend in microseconds.
+ */
+static double	measure(int backend, char *stack)
+{
+	struct timespec	start;
+	struct timespec	end;
+	int				i;
+	int				status;
+	pid_t			pid;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	i = 0;
+	while (i++ < ITERATIONS)
+	{
+		pid = launch(backend, stack);
+		if (pid < 0)
+			return (-1.0);
+		waitpid(pid, &status, 0);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	return (((end.tv_sec - start.tv_sec) * 1e6
+			+ (end.tv_nsec - start.tv_nsec) / 1e3) / ITERATIONS);
+}
+
+/**
+ * @brief Compares fork, vfork, posix_spawn, clone and clone3 launch
+ * latency while the parent holds a growing, fully touched heap.
+ *
+ * Usage: spawn_bench [rss_mb ...] (default: 0 64 256 1024)
+ */
+int	main(int ac, char **av)
+{
+	static const char	*names[] = {"fork", "vfork", "posix_spawn",
+		"clone_vm", "clone3"};
+	static char			*defaults[] = {NULL, "0", "64", "256", "1024"};
+	char				*stack;
+	char				*heap;
+	size_t				mb;
+	int					i;
+	int					b;
+
+	stack = malloc(STACK_SIZE);
+	if (ac < 2)
+	{
+		av = defaults;
+		ac = 5;
+	}
+	printf("%-8s", "rss_mb");
+	b = 0;
+	while (b < 5)
+		printf(" %12s", names[b++]);
+	printf("   (us per launch+wait)\n");
+	i = 1;
+	while (i < ac)
+	{
+		mb = strtoul(av[i++], NULL, 10);
+		heap = malloc(mb << 20 | 1);
+		if (!heap || !stack)
+			return (1);
+		memset(heap, 1, mb << 20 | 1);
+		printf("%-8zu", mb);
+		b = 0;
+		while (b < 5)
+			printf(" %12.1f", measure(b++, stack));
+		printf("\n");
+		free(heap);
+	}
+	free(stack);
+	return (0);
+}
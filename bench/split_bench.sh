@@ -0,0 +1,38 @@
+#!/bin/bash
+
+# Mide una tubería sin estado sobre un fichero grande, entera y
+# repartida en trozos con --split.
+# Uso: bench/split_bench.sh [MB] [N...]
+# Genera unos MB megas de texto y lo pasa por grep -v | tr a-z A-Z con
+# los binarios del sistema, una vez sin --split y otra con cada
+# --split=N (2 y el número de CPUs por defecto). Muestra los tiempos y
+# comprueba que todas las salidas son iguales.
+
+MB=${1:-512}
+shift
+SPLITS=${*:-2 $(nproc)}
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+make -s -C "$ROOT" > /dev/null
+head -c $((MB * 786432)) /dev/urandom | base64 -w 76 > "$TMP/input"
+
+run() {
+	local label=$1 out=$2 start end
+	shift 2
+	start=$(date +%s.%N)
+	"$ROOT/pipex" --no-builtins "$@" -- "$TMP/input" "grep -v QQ" \
+		"tr a-z A-Z" "$out"
+	end=$(date +%s.%N)
+	awk -v n="$label" -v s="$start" -v e="$end" -v mb="$MB" \
+		'BEGIN { printf "  %-12s %8.3f s %8.0f MB/s\n", n, e - s,
+			mb / (e - s) }'
+}
+
+echo "$(nproc) CPUs"
+run "sin split" "$TMP/ref"
+for n in $SPLITS; do
+	run "--split=$n" "$TMP/out" --split="$n"
+	cmp -s "$TMP/ref" "$TMP/out" || echo "  la salida de --split=$n difiere"
+done
@@ -6,21 +6,46 @@
 /*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/10 13:15:07 by dancuenc          #+#    #+#             */
-/*   Updated: 2025/07/10 17:13:25 by dancuenc         ###   ########.fr       */
+/*   Updated: 2026/10/18 01:25:28 by dancuenc         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef PIPEX_H
 # define PIPEX_H
 
+# ifndef _GNU_SOURCE
+#  define _GNU_SOURCE
+# endif
 # include <string.h>
 # include "libft/libft.h"
 # include <string.h>
+# include <ctype.h>
 # include <errno.h>
 # include <fcntl.h>
+# include <linux/fs.h>
+# include <linux/ioprio.h>
+# include <limits.h>
+# include <sched.h>
+# include <signal.h>
+# include <stddef.h>
+# include <stdint.h>
+# include <dirent.h>
 # include <stdio.h>
 # include <stdlib.h>
+# include <sys/epoll.h>
+# include <sys/ioctl.h>
+# include <sys/mman.h>
+# include <sys/pidfd.h>
+# include <sys/resource.h>
+# include <sys/sendfile.h>
+# include <sys/stat.h>
+# include <sys/syscall.h>
+# include <sys/time.h>
+# include <sys/timerfd.h>
 # include <sys/wait.h>
+# include <spawn.h>
+# include <stdarg.h>
+# include <time.h>
 # include <unistd.h>
 
 # define ERR_INFILE "Infile"
@@ -30,22 +55,888 @@
 # define ERR_ENVP "Environment"
 # define ERR_CMD "Command not found: "
 # define ERR_HEREDOC "here_doc"
+# define ERR_OPTION "Invalid option: "
+# define ERR_QUOTE "Unterminated quote: "
+# define ERR_TIMEOUT "Timed out: "
+# define ERR_EXEC "cannot execute"
+
+# define SPAWN_FORK 0
+# define SPAWN_VFORK 1
+# define SPAWN_POSIX 2
+
+# define HEREDOC_BUFFER 0
+# define HEREDOC_STREAM 1
+# define HEREDOC_SPILL 67108864
+# define HEREDOC_BLOCK 1048576
+
+# define STATS_NONE 0
+# define STATS_TEXT 1
+# define STATS_JSON 2
+
+# define PCACHE_MAGIC 0x50585043
+# define PCACHE_SLOTS 1024
+# define PCACHE_DIRS 64
+# define PCACHE_NAME 64
+# define PCACHE_PATH 192
+
+# define ARENA_BLOCK 65536
+# define ARENA_ALIGN 16
+# ifdef PIPEX_DEBUG
+#  define ARENA_DEBUG 1
+# else
+#  define ARENA_DEBUG 0
+# endif
+
+# define BI_BUF 131072
+# define BI_LINES 0
+# define BI_BYTES 1
+# define WC_LINES 1
+# define WC_WORDS 2
+# define WC_BYTES 4
+# define TAIL_TRIM 1048576
+# define TR_SET_MAX 1024
+# define TR_DELETE 1
+# define TR_SQUEEZE 2
+# define TR_BLOCK 32
+# define GREP_INVERT 1
+# define GREP_COUNT 2
+# define GREP_ICASE 4
+# define GREP_FIXED 8
+# define GREP_BASIC 16
+# define GREP_EXT 32
+# define GREP_PATS 16
+# define GREP_STATES 16777216
+# define GREP_READ 98304
+# define GREP_PAGE 4096
+# define GREP_BINARY "grep: (standard input): binary file matches\n"
+# define GREP_REGEX 64
+# define GREP_POS 256
+# define GREP_WORDS 4
+# define GREP_DFA 1024
+# define GREP_SEEK 8
+# define GREP_DENSE 64
+# define GREP_HOLD 1048576
+# define GREP_REAL -3
+# define RX_LPAREN 256
+# define RX_RPAREN 257
+# define RX_LBRACE 258
+# define RX_ALT 259
+# define RX_PLUS 260
+# define RX_QMARK 261
+# define RX_STAR 262
+# define RX_BOL 263
+# define RX_EOL 264
+# define RX_ANY 265
+# define RX_BRACKET 266
+# define RX_CLASS 267
+# define RX_EOF 268
+# define RX_ERR -1
+
+# define BI_FUSE 6
+# define BI_EXEC -1
+# define COPY_PIPE 1048576
+# define COPY_CHUNK 1073741824
+# define FUSE_CAT 0
+# define FUSE_HEAD 1
+# define FUSE_TR 2
+# define FUSE_SORT 3
+# define SORT_NUM 1
+# define SORT_REV 2
+
+# define SHORT_GRACE 100
+# define SV_EVENTS 16
+# define KILL_AFTER 1000
+# define STAGE_TMO_MAX 32
+# define TIMEOUT_STAGE 1
+# define TIMEOUT_PIPELINE 2
+# define TIMEOUT_EXIT 124
+# define PIPE_SIZE_MAX 32
+# define PIPE_SAMPLE_MS 10
+# define PIPE_AUTO_FDS 8
+# define PIPE_MAX_FILE "/proc/sys/fs/pipe-max-size"
+# define PIN_NONE 0
+# define PIN_COMPACT 1
+# define PIN_DOMAIN 2
+# define PLACE_SCHED 0
+# define PLACE_NICE 1
+# define PLACE_IOPRIO 2
+# define PLACE_MAX 32
+# define CPU_SYS "/sys/devices/system/cpu/cpu%d/%s"
+# define BATCH_MANIFEST 0
+# define BATCH_COMPLETION 1
+# define BATCH_JOBS 64
+# define BATCH_RESULT "%d\t%d\t%.3f\n"
+# define SPLIT_MAX 256
+# define SPLIT_MIN 65536
+
+# define PIDX_SLOTS 1024
+# define PIDX_DENTS 32768
+
+/**
+ * @brief A --stage-timeout: the 1-based command it applies to, or 0 for
+ * every command, and its limit in milliseconds.
+ */
+typedef struct s_stagetmo
+{
+	int			stage;
+	long long	ms;
+}				t_stagetmo;
+
+/**
+ * @brief A --pipe-size: the 1-based command whose input pipe it sizes,
+ * or 0 for every pipe, and the capacity in bytes.
+ */
+typedef struct s_pipesz
+{
+	int		stage;
+	size_t	bytes;
+}			t_pipesz;
+
+/**
+ * @brief A --sched, --nice or --ioprio: the 1-based command it applies
+ * to, or 0 for every command, the PLACE_* kind and the policy, nice
+ * value or ioprio value to set.
+ */
+typedef struct s_stageplace
+{
+	int	stage;
+	int	kind;
+	int	value;
+}		t_stageplace;
+
+/**
+ * @brief Runtime options given as leading --name[=value] arguments.
+ *
+ * spawn_mode selects how stages are launched: SPAWN_FORK (default),
+ * SPAWN_VFORK or SPAWN_POSIX (posix_spawn with prepared file actions).
+ * stats selects the per-stage report format, written to stats_file or
+ * to stderr when it is NULL. heredoc_mode selects how here_doc input
+ * reaches the first stage; buffered input stays in a memfd until it
+ * grows past heredoc_spill bytes, then moves to an anonymous file in
+ * tmpdir. path_cache enables the command path cache, stored in
+ * path_cache_file or in the default location when it is NULL.
+ * path_index resolves commands through an index of the PATH
+ * directories and launches them with execveat. lazy_resolve leaves
+ * resolution to each forked child, so no stage waits for the others.
+ * no_builtins disables the in-process builtins. optimize rewrites the
+ * stage list before it runs; explain prints what it would do instead
+ * of running anything. short_circuit stops the upstream stages as soon
+ * as a stage exits, with SIGPIPE and, grace_ms later, SIGTERM.
+ * timeout_ms limits the whole pipeline and stage_tmo each stage; a
+ * stage past its limit gets SIGTERM, then SIGKILL kill_ms later.
+ * pipe_sz sets the capacity of the pipes between stages; with
+ * pipe_auto the supervisor also grows the pipes it finds full. supervise
+ * is set by the timeouts, short_circuit and pipe_auto, so the stages
+ * are waited for by the pidfd supervisor. pin places the stages on the
+ * CPUs, PIN_COMPACT or PIN_DOMAIN, and place holds the per-stage
+ * scheduling settings; placed is set by any of them. batch names the
+ * manifest of pipelines to run instead of the command line, at most
+ * jobs at a time, while the running ones add up to no more than
+ * max_procs processes and max_fds descriptors (0 for no limit);
+ * batch_order is BATCH_MANIFEST or BATCH_COMPLETION. split runs that
+ * many copies of the pipeline, each over its own part of the infile.
+ */
+typedef struct s_opts
+{
+	int				spawn_mode;
+	int				heredoc_mode;
+	size_t			heredoc_spill;
+	char			*tmpdir;
+	int				stats;
+	char			*stats_file;
+	int				path_cache;
+	char			*path_cache_file;
+	int				path_index;
+	int				lazy_resolve;
+	int				no_builtins;
+	int				optimize;
+	int				explain;
+	int				short_circuit;
+	long long		grace_ms;
+	int				supervise;
+	long long		timeout_ms;
+	long long		kill_ms;
+	int				stage_tmo_count;
+	t_stagetmo		stage_tmo[STAGE_TMO_MAX];
+	int				pipe_auto;
+	int				pipe_sz_count;
+	t_pipesz		pipe_sz[PIPE_SIZE_MAX];
+	int				pin;
+	int				placed;
+	int				place_count;
+	t_stageplace	place[PLACE_MAX];
+	char			*batch;
+	int				jobs;
+	int				batch_order;
+	int				max_procs;
+	int				max_fds;
+	int				split;
+}					t_opts;
+
+/**
+ * @brief Destination of here_doc input.
+ *
+ * fd is a memfd, an anonymous file or the streaming pipe. size counts
+ * the bytes written; once it would exceed spill_at (0 disables it) the
+ * data moves to an anonymous file in tmpdir.
+ */
+typedef struct s_hdsink
+{
+	int		fd;
+	size_t	size;
+	size_t	spill_at;
+	char	*tmpdir;
+}			t_hdsink;
+
+/**
+ * @brief Block reader state for non-interactive here_doc input.
+ *
+ * buf[0, len) holds unwritten input; its first skip bytes are the
+ * virtual newline that lets a limiter on the first line match pat,
+ * which is "\nLIMITER\n" (plen bytes).
+ */
+typedef struct s_bulk
+{
+	char	*buf;
+	char	*pat;
+	size_t	cap;
+	size_t	len;
+	size_t	plen;
+	size_t	skip;
+}			t_bulk;
+
+/**
+ * @brief Runtime record of one pipeline stage.
+ *
+ * start/end are CLOCK_MONOTONIC timestamps taken before launch and at
+ * reap time; usage comes from wait4 and the io_* counters from
+ * /proc/<pid>/io, read while the stage is still a zombie. pidfd is
+ * watched by the supervisor; stopped is the last signal it sent to
+ * the stage, the next one being due at kill_at. deadline is when the
+ * stage's own timeout runs out, or zero; timed_out records which
+ * timeout, TIMEOUT_STAGE or TIMEOUT_PIPELINE, stopped it. pipe_size is
+ * the capacity of the pipe the stage reads, grown pipe_grows times;
+ * with --pipe-size=auto the parent keeps its read end in pipe_rd, or -1,
+ * until the stage is reaped, for the first PIPE_AUTO_FDS pipes only.
+ */
+typedef struct s_stage
+{
+	pid_t			pid;
+	int				status;
+	int				reaped;
+	struct timespec	start;
+	struct timespec	end;
+	struct rusage	usage;
+	long long		io_rchar;
+	long long		io_wchar;
+	long long		io_read_bytes;
+	long long		io_write_bytes;
+	int				pidfd;
+	int				stopped;
+	struct timespec	kill_at;
+	struct timespec	deadline;
+	int				timed_out;
+	int				pipe_size;
+	int				pipe_grows;
+	int				pipe_rd;
+}					t_stage;
+
+/**
+ * @brief State of the pidfd supervisor.
+ *
+ * ep watches each stage's pidfd, with the stage index as its data, and
+ * the timerfd tfd, with the stage count. live counts the stages not yet
+ * reaped. deadline ends the whole pipeline, or is zero; next is when
+ * tfd fires. timed_out is set once the pipeline or the last stage has
+ * run out of time. sample_at is when the pipes are next sampled.
+ */
+typedef struct s_super
+{
+	int				ep;
+	int				tfd;
+	int				live;
+	int				timed_out;
+	struct timespec	deadline;
+	struct timespec	next;
+	struct timespec	sample_at;
+}					t_super;
+
+/**
+ * @brief Header of the command path cache file.
+ *
+ * Everything before used must match the current PATH string and the
+ * mtime of each of its directories, otherwise the cache is stale.
+ * The header is followed by PCACHE_SLOTS slots.
+ */
+typedef struct s_pcache_hdr
+{
+	uint32_t	magic;
+	uint32_t	nslots;
+	uint64_t	path_hash;
+	uint64_t	path_len;
+	uint64_t	ndirs;
+	int64_t		mtime_sec[PCACHE_DIRS];
+	int64_t		mtime_nsec[PCACHE_DIRS];
+	uint64_t	used;
+}				t_pcache_hdr;
+
+/**
+ * @brief One open-addressing slot: a command name and its path.
+ *
+ * hash is the FNV-1a hash of name; 0 marks an empty slot.
+ */
+typedef struct s_pcache_slot
+{
+	uint64_t	hash;
+	char		name[PCACHE_NAME];
+	char		path[PCACHE_PATH];
+}				t_pcache_slot;
+
+/**
+ * @brief Command path cache, mapped from file or freshly allocated.
+ *
+ * want is the header expected for the current PATH. A valid file is
+ * mapped privately, so lookups cost no syscalls; when dirty, the
+ * table is written back with a rename so readers never see it torn.
+ */
+typedef struct s_pcache
+{
+	t_pcache_hdr	want;
+	t_pcache_hdr	*hdr;
+	t_pcache_slot	*slots;
+	size_t			size;
+	int				mapped;
+	int				dirty;
+	char			file[PATH_MAX];
+}					t_pcache;
+
+/**
+ * @brief Block of the pipex arena; its data follows the header.
+ */
+typedef struct s_ablock
+{
+	struct s_ablock	*next;
+	size_t			cap;
+	size_t			used;
+	size_t			pad;
+}					t_ablock;
+
+/**
+ * @brief Bump allocator for everything parsed before the first fork.
+ *
+ * The PATH list, every argv and every resolved path are packed into
+ * ARENA_BLOCK-sized blocks, so children read them from a few pages and
+ * teardown is one reset. allocs, bytes and blocks are the counters
+ * reported by PIPEX_DEBUG builds.
+ */
+typedef struct s_arena
+{
+	t_ablock	*head;
+	size_t		allocs;
+	size_t		bytes;
+	size_t		blocks;
+}				t_arena;
+
+/**
+ * @brief One entry of the PATH index.
+ *
+ * off is the offset of the name in the pool and dir the first PATH
+ * directory that has it; hash 0 marks an empty slot.
+ */
+typedef struct s_pidx_slot
+{
+	uint64_t	hash;
+	uint32_t	off;
+	int32_t		dir;
+}				t_pidx_slot;
+
+/**
+ * @brief Names found in the PATH directories, read once with getdents64.
+ *
+ * fds holds one directory descriptor per PATH entry (-1 if it could not
+ * be opened); they stay open so stages can open their command relative
+ * to them. slots is a power-of-two open-addressing table.
+ */
+typedef struct s_pathidx
+{
+	int			*fds;
+	int			ndirs;
+	t_pidx_slot	*slots;
+	size_t		cap;
+	size_t		used;
+	char		*pool;
+	size_t		pool_len;
+	size_t		pool_cap;
+}				t_pathidx;
+
+/**
+ * @brief A tr set as a bitmap for the SIMD kernels.
+ *
+ * bits is indexed by low nibble and holds one bit per high nibble:
+ * entries 0-15 for bytes below 0x80, 16-31 for the rest. With runs
+ * set, only a member equal to the byte before it counts, as for -s.
+ */
+typedef struct s_trset
+{
+	unsigned char	bits[32];
+	int				runs;
+}					t_trset;
+
+/**
+ * @brief Tables of the tr builtin prepared for its SIMD kernels.
+ *
+ * rows lists the high nibbles whose 16 map entries are not the
+ * identity; del and sq are the -d and -s sets. last is the last byte
+ * written, for squeezing across reads.
+ */
+typedef struct s_trplan
+{
+	int				nrows;
+	unsigned char	rows[16];
+	t_trset			del;
+	t_trset			sq;
+	int				last;
+}					t_trplan;
+
+/**
+ * @brief A <ctype.h> classification function.
+ */
+typedef int	(*t_ctype)(int);
+
+/**
+ * @brief Arguments of a builtin, filled by its parse function.
+ *
+ * mode holds the WC_* flags for wc, BI_LINES or BI_BYTES for head and
+ * tail, and the TR_* or GREP_* flags. count is the head/tail count or
+ * grep's -m (-1 for none), files the cat operands; map, del and sq are
+ * tr's translation, deletion and squeeze tables. pats are grep's -e
+ * patterns or its PATTERNS operand, pat_file its -f file. kind is a
+ * FUSE_* value for the elements of a fused stage; for the fused stage
+ * itself, files is its argv and count its number of elements.
+ */
+typedef struct s_bargs
+{
+	int				mode;
+	long long		count;
+	char			**files;
+	unsigned char	map[256];
+	unsigned char	del[256];
+	unsigned char	sq[256];
+	t_trplan		plan;
+	const char		*pats[GREP_PATS];
+	int				npats;
+	const char		*pat_file;
+	int				kind;
+}					t_bargs;
+
+/**
+ * @brief Entry of the builtin registry.
+ *
+ * parse returns 0 when every argument is supported; otherwise the
+ * stage runs the real binary. run returns the exit status, or BI_EXEC
+ * to leave the stage to the real binary after all.
+ */
+typedef struct s_builtin
+{
+	const char	*name;
+	int			(*parse)(char **argv, t_bargs *args);
+	int			(*run)(t_bargs *args);
+}				t_builtin;
+
+/**
+ * @brief Running counts of the wc builtin.
+ */
+typedef struct s_wc
+{
+	long long	lines;
+	long long	words;
+	long long	bytes;
+	int			in_word;
+}				t_wc;
+
+/**
+ * @brief One bit per byte of a 64-byte block, for the wc kernels.
+ *
+ * nl marks newlines, sp the space class (\t to \r and ' ') and pr the
+ * printable bytes.
+ */
+typedef struct s_wcmask
+{
+	uint64_t	nl;
+	uint64_t	sp;
+	uint64_t	pr;
+}				t_wcmask;
+
+/**
+ * @brief SIMD kernels of the wc builtin.
+ *
+ * masks classifies 64 bytes; lines counts the newlines of every full
+ * 64-byte block of a buffer, for when words are not needed.
+ */
+typedef struct s_wcops
+{
+	void	(*masks)(const unsigned char *p, t_wcmask *m);
+	size_t	(*lines)(const unsigned char *p, size_t len);
+}			t_wcops;
+
+/**
+ * @brief SIMD kernels of the tr builtin.
+ *
+ * map translates the full vectors of buf in place. keep copies to dst
+ * the leading full vectors of src that hold no byte of set; dst may not
+ * lie after src, and src[-1] must be readable for a runs set. Both
+ * return the number of bytes done.
+ */
+typedef struct s_trops
+{
+	size_t	(*map)(const t_bargs *args, unsigned char *buf, size_t len);
+	size_t	(*keep)(const t_trset *set, unsigned char *dst,
+			const unsigned char *src, size_t len);
+}			t_trops;
+
+/**
+ * @brief Aho-Corasick automaton of the grep builtin for pattern lists.
+ *
+ * Bytes that occur in no pattern share class 0. next holds ncls
+ * entries per state, already multiplied by ncls; a transition into a
+ * state that ends a pattern is -1.
+ */
+typedef struct s_grepac
+{
+	int32_t			*next;
+	unsigned char	cls[256];
+	int				ncls;
+	size_t			nstates;
+}					t_grepac;
+
+/**
+ * @brief First and last positions of a parsed subexpression, and
+ * whether it matches the empty string.
+ */
+typedef struct s_rxfrag
+{
+	uint64_t	first[GREP_WORDS];
+	uint64_t	last[GREP_WORDS];
+	int			nullable;
+}				t_rxfrag;
+
+/**
+ * @brief Position automaton of the grep regex and its lazy DFA.
+ *
+ * Each atom of the patterns is a position: a byte set, an RX_BOL or
+ * RX_EOL anchor, or the final RX_EOF. follow lists the positions that
+ * may come after each one, whole is the alternation of every pattern.
+ * must is a string every match contains, for the prefilter.
+ *
+ * A DFA state is the set of positions waiting for the next byte; the
+ * newline byte is class 0 and leads back to state 0 (a line start).
+ * States are built on first use: next holds ncls entries per state,
+ * the next state's offset, -1 until built or -2 for a match. sets and
+ * slots are the states' position sets and their hash table. After
+ * GREP_DFA states the cache is emptied and refilled.
+ *
+ * The idle state holds only the first positions: any byte but the
+ * newline and the nseek bytes in seek that start a match leads back to
+ * it. Transitions into it are -3, and the scan jumps with find to the
+ * next such byte. nseek is 0 when more than GREP_SEEK bytes would be
+ * needed, and 1 (just the newline) for anchored patterns. dense counts
+ * the lines in a row where the must string was found right after the
+ * previous candidate line.
+ */
+typedef struct s_grepdfa
+{
+	int				flags;
+	int				utf8;
+	int				npos;
+	int				npats;
+	int				nomust;
+	int				kind[GREP_POS];
+	uint64_t		set[GREP_POS][4];
+	uint64_t		follow[GREP_POS][GREP_WORDS];
+	t_rxfrag		whole;
+	unsigned char	must[GREP_POS];
+	size_t			mustlen;
+	unsigned char	cls[256];
+	unsigned char	rep[256];
+	int				ncls;
+	int32_t			*next;
+	uint64_t		*sets;
+	int32_t			*slots;
+	int				nstates;
+	int				flushes;
+	unsigned char	seek[GREP_SEEK];
+	int				nseek;
+	int32_t			idle;
+	int				dense;
+	size_t			(*find)(const struct s_grepdfa *d,
+			const unsigned char *buf, size_t len);
+}					t_grepdfa;
+
+/**
+ * @brief Cursor of the regex parser.
+ *
+ * depth counts open groups; must is only tracked outside them, and
+ * not while an interval parses its piece again. start is 1 where a BRE
+ * takes ^ as an anchor and 2 right after one; * is literal at both.
+ * run is the literal string being read.
+ */
+typedef struct s_rxparse
+{
+	t_grepdfa			*dfa;
+	const unsigned char	*p;
+	const unsigned char	*end;
+	int					depth;
+	int					start;
+	size_t				runlen;
+	unsigned char		run[GREP_POS];
+}						t_rxparse;
+
+struct	s_grep;
+
+/**
+ * @brief SIMD kernel of the grep builtin.
+ *
+ * find searches for the single pattern and returns its offset, or len.
+ */
+typedef struct s_grepops
+{
+	size_t	(*find)(const struct s_grep *g, const unsigned char *buf,
+			size_t len);
+}			t_grepops;
+
+/**
+ * @brief State of the grep builtin.
+ *
+ * text holds every pattern followed by a newline, case-folded with -i;
+ * npats is their count. A single pattern of plen bytes is searched
+ * with ops, or grep_scan without SIMD, using first and last (each in
+ * both cases with -i) as the prefilter. binary is 1 once a NUL was
+ * read and 2 once a line was selected after that; enc_err records a
+ * selected line that was not valid UTF-8. With GREP_REGEX, dfa matches
+ * the patterns and text is replaced by its must string, searched the
+ * same way to find the lines worth running the DFA on. While held is
+ * set no output is written, so a NUL can still hand the stage to the
+ * real grep: origin is where a regular stdin started, or -1; for any
+ * other stdin, replay keeps the rlen bytes read so far and hout the
+ * hlen bytes of output that did not fit in out.
+ */
+typedef struct s_grep
+{
+	int				flags;
+	long long		max;
+	long long		selected;
+	int				binary;
+	int				enc_err;
+	int				utf8;
+	int				match_all;
+	unsigned char	*text;
+	size_t			len;
+	size_t			npats;
+	size_t			plen;
+	unsigned char	first[2];
+	unsigned char	last[2];
+	unsigned char	fold[256];
+	t_grepac		ac;
+	t_grepdfa		*dfa;
+	const t_grepops	*ops;
+	int				held;
+	off_t			origin;
+	char			*replay;
+	size_t			rlen;
+	char			*hout;
+	size_t			hlen;
+	size_t			olen;
+	char			out[BI_BUF];
+}					t_grep;
+
+/**
+ * @brief Input kept by the tail builtin.
+ *
+ * buf[0, len) holds the input that may still be printed; it is trimmed
+ * to the last count lines or bytes once len reaches next_trim.
+ */
+typedef struct s_tailbuf
+{
+	char	*buf;
+	size_t	len;
+	size_t	cap;
+	size_t	next_trim;
+}			t_tailbuf;
+
+/**
+ * @brief A line kept by the top-K sort, NUL-terminated.
+ */
+typedef struct s_sline
+{
+	unsigned char	*s;
+	size_t			len;
+}					t_sline;
+
+/**
+ * @brief The k lines that sort first so far, as a heap.
+ *
+ * heap[0] is the line that sorts last, the first to be replaced. mode
+ * holds the SORT_* flags.
+ */
+typedef struct s_topk
+{
+	t_sline		*heap;
+	size_t		n;
+	size_t		cap;
+	long long	k;
+	int			mode;
+}				t_topk;
+
+/**
+ * @brief CPU placement computed by the parent for --pin.
+ *
+ * cpus lists the CPUs the parent may run on, which the cgroup's cpuset
+ * already restricts, ordered by package, L3 domain, core and thread,
+ * with the sort key of each in keys. domain is the set of those CPUs
+ * sharing the L3 cache of the first one.
+ */
+typedef struct s_place
+{
+	int			*cpus;
+	long long	*keys;
+	int			count;
+	cpu_set_t	domain;
+}				t_place;
+
+/**
+ * @brief One pipeline of a --batch manifest.
+ *
+ * av is the line as a pipex command line, av[1] the infile and
+ * av[ac - 1] the outfile. procs and fds are what it counts against
+ * --max-procs and --max-fds while it runs. status is -1 until it is
+ * known; a line that cannot run gets 1 without being launched.
+ */
+typedef struct s_job
+{
+	char			**av;
+	int				ac;
+	int				line;
+	pid_t			pid;
+	int				procs;
+	int				fds;
+	int				status;
+	struct timespec	start;
+	double			ms;
+}					t_job;
+
+/**
+ * @brief The --batch worker pool.
+ *
+ * next is the first job not launched yet and printed the first whose
+ * result has not been written; running, procs and fds add up the jobs
+ * that are running, and live holds their indices in jobs.
+ */
+typedef struct s_batch
+{
+	t_job	*jobs;
+	int		*live;
+	int		count;
+	int		cap;
+	int		next;
+	int		printed;
+	int		running;
+	int		procs;
+	int		fds;
+	int		failed;
+}			t_batch;
+
+/**
+ * @brief One part of a --split infile, [start, end) cut after a
+ * newline, and the copy of the pipeline that runs over it.
+ *
+ * out receives the copy's output: the outfile itself for the first
+ * part, an anonymous file for the others. status is -1 while the
+ * copy runs.
+ */
+typedef struct s_chunk
+{
+	off_t	start;
+	off_t	end;
+	int		out;
+	pid_t	pid;
+	int		status;
+}			t_chunk;
+
+/**
+ * @brief The copies of a --split run.
+ *
+ * done is the first part whose output has not been appended to the
+ * outfile yet, status the first non-zero exit status among those that
+ * were.
+ */
+typedef struct s_split
+{
+	t_chunk	*parts;
+	int		count;
+	int		done;
+	int		status;
+	char	**envp;
+}			t_split;
 
 typedef struct s_pipex
 {
 	int		in_fd;
 	int		out_fd;
 	int		here_doc;
+	pid_t	heredoc_pid;
 	int		is_invalid_infile;
+	char	**paths;
 	char	**cmd_paths;
 	char	***cmd_args;
 	int		cmd_count;
-	int		pipe_count;
-	int		*pipes;
+	int		prev_fd;
+	int		pipe_fd[2];
 	int		idx;
 	pid_t	pid;
+	t_stage		*stages;
+	t_pathidx	pidx;
+	int			*cmd_dirs;
+	int			*cmd_builtin;
+	int			*cmd_fused;
+	int			passthrough;
+	int			copy_status;
+	off_t		in_size;
+	int			cut_stage;
+	t_place		place;
+	t_chunk		*chunk;
+	t_arena		arena;
+	t_opts		opts;
 }			t_pipex;
 
+/**
+ * @brief Stage list being rewritten by the planner.
+ *
+ * args is the argv of each stage; a fused stage holds fused[i]
+ * NULL-terminated argvs one after another, followed by an empty one.
+ * orig is the 1-based position in the command line of each stage's
+ * first command, for the --explain output.
+ */
+typedef struct s_plan
+{
+	char	***args;
+	int		*fused;
+	int		*orig;
+	int		count;
+	int		infile_ok;
+	int		builtins;
+	int		explain;
+	t_arena	*arena;
+}			t_plan;
+
+/**
+ * @brief Entry of the option table: a name and the handler of its value.
+ */
+typedef struct s_option
+{
+	const char	*name;
+	int			(*apply)(char *value, t_pipex *pipex);
+}				t_option;
+
 /**
  * @brief Entry point for the pipex program.
  *
@@ -62,6 +953,9 @@ int			main(int ac, char **av, char **envp);
 /**
  * @brief Initializes the files for the pipex program.
  *
+ * Exits with status 1 when the stage table cannot be allocated, since
+ * every later step indexes it.
+ *
  * @param argv Argument vector.
  * @param argc Argument count.
  */
@@ -84,19 +978,78 @@ void		get_infile(char **argv, t_pipex *pipex);
 void		get_outfile(char *argv, t_pipex *pipex);
 
 /**
- * @brief Creates pipes for the pipex program.
+ * @brief Opens the pipe between the current stage and the next one.
+ *
+ * Pipes are created just in time with O_CLOEXEC, so the parent holds
+ * at most one pipe plus the read end left by the previous stage, and
+ * children need no close loop before execve.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success (or on the last stage), 1 if pipe2 failed.
+*/
+int			open_stage_pipe(t_pipex *pipex);
+
+/**
+ * @brief Sizes the pipe just opened in front of the next stage.
+ *
+ * Applies its --pipe-size, capped at /proc/sys/fs/pipe-max-size, and
+ * records the capacity the kernel gave it. With --pipe-size=auto the
+ * read end of the first PIPE_AUTO_FDS pipes is kept for pipe_sample, so
+ * the parent holds a bounded number of descriptors however long the
+ * pipeline is; the later pipes keep their size.
+ *
+ * @param pipex Pointer to the pipex struct.
+*/
+void		size_stage_pipe(t_pipex *pipex);
+
+/**
+ * @brief Samples the pipes with FIONREAD once their period is over and
+ * doubles each one found at least three quarters full, since its writer
+ * is then about to stall on its reader.
  *
  * @param pipex Pointer to the pipex struct.
+ * @param at When the next sample is due; zero for now, and moved on.
+ * @param now The current time.
+ * @return 1, as a sample is always pending.
 */
-void		create_pipes(t_pipex *pipex);
+int			pipe_sample(t_pipex *pipex, struct timespec *at,
+				struct timespec *now);
 
 /**
- * @brief Closes pipes for the pipex program.
+ * @brief Releases the parent's pipe ends once the current stage runs.
+ *
+ * Closes the previous read end and the current write end, and keeps the
+ * current read end as input for the next stage. A streamed here_doc pipe
+ * is closed once the first stage holds it, so the feeder gets EPIPE as
+ * soon as that stage exits.
+ *
+ * @param pipex Pointer to the pipex struct.
+*/
+void		advance_pipes(t_pipex *pipex);
+
+/**
+ * @brief Closes every pipe end still held by the parent.
  *
  * @param pipex Pointer to the pipex struct.
 */
 void		close_pipes(t_pipex *pipex);
 
+/**
+ * @brief Returns the descriptor the current stage reads from.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @return The infile for the first stage, the previous pipe otherwise.
+*/
+int			stage_in_fd(t_pipex *pipex);
+
+/**
+ * @brief Returns the descriptor the current stage writes to.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @return The outfile for the last stage, the current pipe otherwise.
+*/
+int			stage_out_fd(t_pipex *pipex);
+
 /**
  * @brief Redirects input and output file descriptors.
  *
@@ -115,6 +1068,9 @@ void		setup_child_io(t_pipex *pipex);
 /**
  * @brief Handles errors for child processes.
  *
+ * "command not found" goes to the saved standard output, or to stderr
+ * under --batch, whose standard output carries the results.
+ *
  * @param pipex Pointer to the pipex struct.
  * @param saved_stdout Saved standard output file descriptor.
 */
@@ -123,6 +1079,10 @@ void		handle_child_error(t_pipex *pipex, int saved_stdout);
 /**
  * @brief Executes a child command.
  *
+ * Commands resolved through the PATH index are opened relative to
+ * their directory descriptor and run with execveat(AT_EMPTY_PATH) on
+ * that file descriptor, so no name is looked up again at exec time.
+ *
  * @param pipex Pointer to the pipex struct.
  * @param envp Environment variables.
 */
@@ -137,79 +1097,1976 @@ void		execute_child_command(t_pipex *pipex, char **envp);
 void		create_child_process(t_pipex *pipex, char **envp);
 
 /**
- * @brief Checks if the argument is a heredoc and sets the heredoc flag.
+ * @brief Launches the current stage through the configured spawn backend.
+ *
+ * Every dup2/close action is prepared in the parent, so the child only
+ * runs async-signal-safe syscalls before execve. Stages that need the
+ * error handling of the fork path (missing command, invalid infile or
+ * outfile), and placed stages, since place_stage cannot run in a
+ * posix_spawn or vfork child, are left to the caller.
  *
- * @param arg Argument string.
  * @param pipex Pointer to the pipex struct.
+ * @param envp Environment variables.
+ * @return 0 if the stage was launched, or its failed exec reported, 1 if
+ * the caller must fork it.
 */
-int			check_and_set_heredoc(char *arg, t_pipex *pipex);
+int			launch_stage(t_pipex *pipex, char **envp);
 
 /**
- * @brief Creates a heredoc file.
+ * @brief Reads the CPU topology for --pin.
+ *
+ * Orders the allowed CPUs so that neighbours share a core, then an L3
+ * cache, then a package, and records the L3 domain of the first one.
+ * Leaves place.count at 0 when --pin is not set or the topology cannot
+ * be read.
  *
- * @return The file descriptor of the created file.
+ * @param pipex Pointer to the pipex struct.
 */
-int			create_heredoc_file(void);
+void		place_init(t_pipex *pipex);
 
 /**
- * @brief Processes input for a heredoc.
+ * @brief Applies --pin, --sched, --nice and --ioprio to the calling
+ * child before it runs its command.
  *
- * @param limiter The limiter string.
- * @param fd The file descriptor to write to.
+ * A setting the kernel refuses is reported with bi_fail and the stage
+ * runs without it, so only fork children call it.
+ *
+ * @param pipex Pointer to the pipex struct, idx being the stage.
 */
-void		process_heredoc_input(char *limiter, int fd);
+void		place_stage(t_pipex *pipex);
 
 /**
- * @brief Handles a heredoc.
+ * @brief Parses the leading --name[=value] options.
  *
- * @param limiter The limiter string.
+ * Parsing stops at the first argument that does not start with "--",
+ * or right after a lone "--".
+ *
+ * @param ac Argument count.
+ * @param av Argument vector.
  * @param pipex Pointer to the pipex struct.
+ * @return Number of arguments consumed, or -1 on an invalid option.
 */
-void		handle_heredoc(char *limiter, t_pipex *pipex);
+int			parse_options(int ac, char **av, t_pipex *pipex);
 
 /**
- * @brief Parses commands for the pipex program.
+ * @brief Waits for any child and records its stage statistics.
+ *
+ * With --stats, the child is first observed with waitid(WNOWAIT) so
+ * /proc/<pid>/io can be read before wait4 reaps it with its rusage.
+ * Children that are not pipeline stages are reaped without a record.
  *
  * @param pipex Pointer to the pipex struct.
- * @param argv Argument vector.
+ * @param status Receives the wait status.
+ * @return The reaped pid, or -1 when no children are left.
 */
-void		parse_cmds(t_pipex *pipex, char **argv);
+pid_t		reap_child(t_pipex *pipex, int *status);
 
 /**
- * @brief Parses paths for the pipex program.
+ * @brief Reaps one stage, records its statistics and closes the read
+ * end of its input pipe if the parent kept one.
  *
  * @param pipex Pointer to the pipex struct.
- * @param envp Environment variables.
+ * @param stage The stage, whose process has exited.
+ * @param status Receives the wait status.
+ * @return The reaped pid, or -1 on error.
 */
-void		parse_paths(t_pipex *pipex, char **envp);
+pid_t		reap_stage(t_pipex *pipex, t_stage *stage, int *status);
 
 /**
- * @brief Safely closes a file descriptor and sets it to -1.
+ * @brief Returns the stage record of a child pid.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param pid Child pid.
+ * @return The stage record, or NULL if pid is not a pipeline stage.
+*/
+t_stage		*find_stage(t_pipex *pipex, pid_t pid);
+
+/**
+ * @brief Writes the per-stage statistics report and the pipeline total.
+ *
+ * @param pipex Pointer to the pipex struct.
+*/
+void		report_stats(t_pipex *pipex);
+
+/**
+ * @brief Writes a stage's command line, words separated by spaces.
+ *
+ * @param fd Descriptor to write to.
+ * @param args Argument vector of the stage.
+ * @param json Non-zero to escape the words as a JSON string body.
+*/
+void		write_command(int fd, char **args, int json);
+
+/**
+ * @brief Writes the statistics report as a single JSON object.
+ *
+ * @param fd Descriptor to write to.
+ * @param pipex Pointer to the pipex struct.
+ * @param total Pipeline total.
+*/
+void		print_stats_json(int fd, t_pipex *pipex, t_stage *total);
+
+/**
+ * @brief Converts a wait status to a shell-style exit code.
+ *
+ * @param status Wait status.
+ * @return The exit code, 128 + signal for a killed stage, -1 otherwise.
+*/
+int			stage_exit_code(int status);
+
+/**
+ * @brief Returns the milliseconds elapsed between two timestamps.
+ *
+ * @param start Start timestamp.
+ * @param end End timestamp.
+ * @return Elapsed milliseconds.
+*/
+double		elapsed_ms(struct timespec *start, struct timespec *end);
+
+/**
+ * @brief Converts a timeval (as found in struct rusage) to milliseconds.
+ *
+ * @param tv Time value.
+ * @return Milliseconds.
+*/
+double		usage_ms(struct timeval *tv);
+
+/**
+ * @brief Sets a timestamp to a number of milliseconds from now.
+ *
+ * @param at Receives the CLOCK_MONOTONIC deadline.
+ * @param ms Milliseconds from now.
+*/
+void		deadline_ms(struct timespec *at, long long ms);
+
+/**
+ * @brief Adds milliseconds to a timestamp.
+ *
+ * @param at The timestamp.
+ * @param ms Milliseconds to add.
+*/
+void		ts_add_ms(struct timespec *at, long long ms);
+
+/**
+ * @brief Waits for the stages through their pidfds, enforcing the
+ * timeouts and, with --short-circuit, stopping the stages upstream of
+ * any stage that exits.
+ *
+ * The upstream stages get SIGPIPE at once, as they would on their next
+ * write, and SIGTERM if they are still running grace_ms later. A stage
+ * out of time gets SIGTERM, and any stage still alive kill_ms after
+ * SIGTERM gets SIGKILL. When pidfds, epoll or timerfd are not
+ * available it says so and falls back to supervise_wait.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param last Exit status to return if the last stage is not reaped.
+ * @return The exit status of the last stage, as handle_exit_status
+ * reports it, or TIMEOUT_EXIT if the pipeline or the last stage ran
+ * out of time.
+*/
+int			supervise(t_pipex *pipex, int last);
+
+/**
+ * @brief Reaps a stage that has ended and, with --short-circuit,
+ * sends SIGPIPE to every stage upstream of it that is still running.
+ * The timerfd needs nothing: the supervisor rearms it.
+ *
+ * Nothing reads what those stages write any more, so they would get
+ * SIGPIPE on their next write anyway; a stage blocked on its input
+ * gets it now instead.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param sv The supervisor.
+ * @param i Index of the stage, or the stage count for the timerfd.
+ * @param last Exit status of the last stage; updated if it was i.
+*/
+void		supervise_event(t_pipex *pipex, t_super *sv, int i, int *last);
+
+/**
+ * @brief Waits for the stages without pidfds, enforcing the same
+ * limits: SIGCHLD and a SIGALRM set for the next deadline wake it up.
+ *
+ * Used when the pidfd supervisor cannot be set up.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param sv The supervisor, with its deadlines set.
+ * @param last Exit status of the last stage; updated when it is reaped.
+*/
+void		supervise_wait(t_pipex *pipex, t_super *sv, int *last);
+
+/**
+ * @brief Sends a signal to a stage and records it; the next step of
+ * the escalation is due ms later.
+ *
+ * @param stage The stage.
+ * @param sig The signal.
+ * @param ms Milliseconds until the next signal.
+*/
+void		stage_signal(t_stage *stage, int sig, long long ms);
+
+/**
+ * @brief Sends every signal that is due, samples the pipes with
+ * --pipe-size=auto, and computes when the timer should fire next.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param sv The supervisor; next is updated.
+ * @return 1 if a signal is pending, 0 otherwise.
+*/
+int			supervise_due(t_pipex *pipex, t_super *sv);
+
+/**
+ * @brief Returns the --stage-timeout of a stage in milliseconds.
+ *
+ * A limit given for the stage's own number wins over one given for
+ * every stage; the last one given wins among equals.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param i Index of the stage.
+ * @return The limit, or 0 for none.
+*/
+long long	stage_timeout(t_pipex *pipex, int i);
+
+/**
+ * @brief Sets the pipeline deadline and each stage's own deadline,
+ * counted from its launch.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param sv The supervisor.
+*/
+void		supervise_deadlines(t_pipex *pipex, t_super *sv);
+
+/**
+ * @brief Writes to stderr which stages ran out of time and which limit
+ * stopped each of them.
+ *
+ * @param pipex Pointer to the pipex struct.
+*/
+void		report_timeouts(t_pipex *pipex);
+
+/**
+ * @brief Returns the short name of the signal a stage was stopped
+ * with, or "-".
+ *
+ * @param stage The stage.
+ * @return The signal name, e.g. "PIPE".
+*/
+const char	*stage_stopped(t_stage *stage);
+
+/**
+ * @brief Writes what the short-circuit saved: which stage set it off,
+ * how many stages it stopped and how much of the infile was never read.
+ *
+ * Writes nothing when no stage was stopped.
+ *
+ * @param fd Descriptor to write to.
+ * @param pipex Pointer to the pipex struct.
+ * @param json 1 for a JSON member, 0 for a line of text.
+*/
+void		print_saved(int fd, t_pipex *pipex, int json);
+
+/**
+ * @brief Applies --spawn=fork|vfork|posix_spawn.
+ *
+ * @param value Option value.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, 1 on an unknown backend.
+*/
+int			opt_spawn(char *value, t_pipex *pipex);
+
+/**
+ * @brief Applies --heredoc=buffer|stream.
+ *
+ * @param value Option value.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, 1 on an unknown mode.
+*/
+int			opt_heredoc(char *value, t_pipex *pipex);
+
+/**
+ * @brief Applies --heredoc-spill=SIZE.
+ *
+ * @param value Size in bytes, with an optional K, M or G suffix.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, 1 on a malformed size.
+*/
+int			opt_heredoc_spill(char *value, t_pipex *pipex);
+
+/**
+ * @brief Applies --tmpdir=DIR.
+ *
+ * @param value Directory used when here_doc input spills to disk.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, 1 if the directory is missing.
+*/
+int			opt_tmpdir(char *value, t_pipex *pipex);
+
+/**
+ * @brief Parses a byte count with an optional K, M or G suffix.
+ *
+ * @param str String to parse.
+ * @param size Receives the byte count.
+ * @return 0 on success, 1 on a malformed size.
+*/
+int			parse_size(const char *str, size_t *size);
+
+/**
+ * @brief Parses a duration in seconds, with up to three decimals.
+ *
+ * @param str String to parse, e.g. "2" or "0.25".
+ * @param ms Receives the duration in milliseconds.
+ * @return 0 on success, 1 on a malformed duration.
+*/
+int			parse_secs(const char *str, long long *ms);
+
+/**
+ * @brief Consumes the "N:" that selects one command in a per-stage
+ * option value.
+ *
+ * @param value The value; moved past the prefix when there is one.
+ * @param min Smallest command number allowed.
+ * @param stage Receives N, or 0 when there is no prefix.
+ * @return 0 on success, 1 on a malformed or out-of-range N.
+*/
+int			parse_stage_prefix(char **value, int min, int *stage);
+
+/**
+ * @brief Applies --stats[=text|json].
+ *
+ * @param value Option value, NULL for the text report.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, 1 on an unknown format.
+*/
+int			opt_stats(char *value, t_pipex *pipex);
+
+/**
+ * @brief Applies --stats-file=PATH.
+ *
+ * @param value Path of the report file.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, 1 if the path is missing.
+*/
+int			opt_stats_file(char *value, t_pipex *pipex);
+
+/**
+ * @brief Applies --path-cache[=FILE].
+ *
+ * @param value Cache file, or NULL for the default location.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, 1 if FILE is empty.
+*/
+int			opt_path_cache(char *value, t_pipex *pipex);
+
+/**
+ * @brief Applies --path-index.
+ *
+ * @param value Must be NULL.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, 1 if a value was given.
+*/
+int			opt_path_index(char *value, t_pipex *pipex);
+
+/**
+ * @brief Applies --lazy-resolve.
+ *
+ * @param value Must be NULL.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, 1 if a value was given.
+*/
+int			opt_lazy_resolve(char *value, t_pipex *pipex);
+
+/**
+ * @brief Applies --no-builtins.
+ *
+ * @param value Must be NULL.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, 1 if a value was given.
+*/
+int			opt_no_builtins(char *value, t_pipex *pipex);
+
+/**
+ * @brief Applies --optimize.
+ *
+ * @param value Must be NULL.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, 1 if a value was given.
+*/
+int			opt_optimize(char *value, t_pipex *pipex);
+
+/**
+ * @brief Applies --explain.
+ *
+ * @param value Must be NULL.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, 1 if a value was given.
+*/
+int			opt_explain(char *value, t_pipex *pipex);
+
+/**
+ * @brief Applies --split=N.
+ *
+ * @param value N, from 1 to SPLIT_MAX.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, 1 on a malformed value.
+*/
+int			opt_split(char *value, t_pipex *pipex);
+
+/**
+ * @brief Applies --short-circuit[=GRACE_MS].
+ *
+ * @param value Milliseconds between SIGPIPE and SIGTERM, or NULL for
+ * SHORT_GRACE.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, 1 on a malformed value.
+*/
+int			opt_short_circuit(char *value, t_pipex *pipex);
+
+/**
+ * @brief Applies --timeout=SECS, the limit of the whole pipeline.
+ *
+ * @param value Seconds, 0 for no limit.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, 1 on a missing or malformed value.
+*/
+int			opt_timeout(char *value, t_pipex *pipex);
+
+/**
+ * @brief Applies --stage-timeout=[N:]SECS, the limit of the Nth
+ * command, or of every command without N.
+ *
+ * @param value The limit, optionally prefixed by a 1-based command.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, 1 on a malformed value or too many limits.
+*/
+int			opt_stage_timeout(char *value, t_pipex *pipex);
+
+/**
+ * @brief Applies --kill-after=SECS, the time between SIGTERM and
+ * SIGKILL for a stage that ran out of time.
+ *
+ * @param value Seconds.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, 1 on a missing or malformed value.
+*/
+int			opt_kill_after(char *value, t_pipex *pipex);
+
+/**
+ * @brief Applies --pipe-size=BYTES|N:BYTES|auto.
+ *
+ * @param value A size for every pipe, a size for the pipe in front of
+ * the Nth command, or auto for adaptive sizing.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, 1 on a malformed value or too many sizes.
+*/
+int			opt_pipe_size(char *value, t_pipex *pipex);
+
+/**
+ * @brief Applies --pin=compact|domain.
+ *
+ * @param value compact to pin each stage to one CPU, neighbouring
+ * stages on sibling threads or cores, or domain to keep every stage in
+ * one L3 cache domain.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, 1 on a missing or unknown value.
+*/
+int			opt_pin(char *value, t_pipex *pipex);
+
+/**
+ * @brief Applies --sched=[N:]batch|idle|other.
+ *
+ * @param value The scheduling policy, optionally for one command.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, 1 on a malformed value or too many settings.
+*/
+int			opt_sched(char *value, t_pipex *pipex);
+
+/**
+ * @brief Applies --nice=[N:]NICE, a nice value from -20 to 19.
+ *
+ * @param value The nice value, optionally for one command.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, 1 on a malformed value or too many settings.
+*/
+int			opt_nice(char *value, t_pipex *pipex);
+
+/**
+ * @brief Applies --ioprio=[N:]rt|be|idle[,LEVEL], LEVEL from 0 to 7.
+ *
+ * @param value The I/O class and level, optionally for one command.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, 1 on a malformed value or too many settings.
+*/
+int			opt_ioprio(char *value, t_pipex *pipex);
+
+/**
+ * @brief Applies --batch=MANIFEST.
+ *
+ * @param value The manifest, one pipeline per line.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, 1 on a missing value.
+*/
+int			opt_batch(char *value, t_pipex *pipex);
+
+/**
+ * @brief Applies --jobs=N, the number of pipelines run at once.
+ *
+ * @param value N, at least 1.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, 1 on a malformed value.
+*/
+int			opt_jobs(char *value, t_pipex *pipex);
+
+/**
+ * @brief Applies --batch-order=manifest|completion.
+ *
+ * @param value manifest to write the results in manifest order, or
+ * completion to write each as soon as its pipeline ends.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, 1 on a missing or unknown value.
+*/
+int			opt_batch_order(char *value, t_pipex *pipex);
+
+/**
+ * @brief Applies --max-procs=N, the processes the running pipelines
+ * may add up to.
+ *
+ * @param value N, 0 for no limit.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, 1 on a malformed value.
+*/
+int			opt_max_procs(char *value, t_pipex *pipex);
+
+/**
+ * @brief Applies --max-fds=N, the descriptors the running pipelines
+ * may add up to.
+ *
+ * @param value N, 0 for no limit.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, 1 on a malformed value.
+*/
+int			opt_max_fds(char *value, t_pipex *pipex);
+
+/**
+ * @brief Runs one pipeline: sets up the files, launches the stages,
+ * waits for them and reports --stats.
+ *
+ * @param pipex Pointer to the pipex struct, with its options parsed.
+ * @param ac Argument count.
+ * @param av Argument vector: infile, commands and outfile from av[1].
+ * @param envp Environment variables.
+ * @return Exit status of the last command.
+*/
+int			run_pipeline(t_pipex *pipex, int ac, char **av, char **envp);
+
+/**
+ * @brief Reads a --batch manifest into the job list.
+ *
+ * Each line is split like a command, so quotes group words: the first
+ * word is the infile, the last the outfile and the others the commands.
+ * Blank lines and lines starting with # are skipped.
+ *
+ * @param pipex Pointer to the pipex struct, whose arena keeps the lines.
+ * @param b The pool to fill.
+ * @return 0 on success, -1 if the manifest could not be read.
+*/
+int			batch_read(t_pipex *pipex, t_batch *b);
+
+/**
+ * @brief Records that a job has its exit status and writes results to
+ * stdout: its manifest line number, exit status and wall time in
+ * milliseconds, tab-separated.
+ *
+ * In manifest order a result waits until every earlier line has one.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param b The pool.
+ * @param job The job that ended, or was refused.
+*/
+void		batch_done(t_pipex *pipex, t_batch *b, t_job *job);
+
+/**
+ * @brief Runs every pipeline of the --batch manifest on a pool of forked
+ * workers.
+ *
+ * PATH is split, and with --path-index its directories read, once here;
+ * each worker inherits them and runs its line as pipex would. A job is
+ * launched when fewer than --jobs are running and it fits in
+ * --max-procs and --max-fds, or when nothing else is running.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param envp Environment variables.
+ * @return 0 if every pipeline exited with 0, 1 otherwise.
+*/
+int			run_batch(t_pipex *pipex, char **envp);
+
+/**
+ * @brief Runs the pipeline once per newline-aligned part of the infile
+ * and concatenates the outputs in order into the outfile.
+ *
+ * The infile is cut into --split parts of at least SPLIT_MIN bytes;
+ * a here_doc, an infile that is not a regular file or one too small
+ * for two parts runs the pipeline once, as usual. So does a command
+ * split_check cannot resolve, so that it is reported only once. PATH
+ * is loaded before the fork and shared by every copy.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param ac Argument count.
+ * @param av Argument vector.
+ * @param envp Environment variables.
+ * @return 0 if every copy exited with 0, else the first other status.
+*/
+int			run_split(t_pipex *pipex, int ac, char **av, char **envp);
+
+/**
+ * @brief Checks in the parent, before any copy is forked, that every
+ * command parses and resolves to a builtin or an executable.
+ *
+ * @param pipex Pointer to the pipex struct, with paths loaded.
+ * @param ac Argument count.
+ * @param av Argument vector.
+ * @return 0 if every command can run, -1 otherwise.
+*/
+int			split_check(t_pipex *pipex, int ac, char **av);
+
+/**
+ * @brief Gives the first stage of a --split copy its part of the
+ * infile, through a pipe filled by a feeder child with splice.
+ *
+ * The feeder is tracked as heredoc_pid, so it is stopped and reaped
+ * like the here_doc one.
+ *
+ * @param infile Path of the infile.
+ * @param pipex Pointer to the pipex struct, with chunk set.
+*/
+void		feed_chunk(char *infile, t_pipex *pipex);
+
+/**
+ * @brief Waits for a copy to end, then appends to the outfile, in
+ * order, every output whose earlier parts are all done.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param sp The copies.
+ * @return 0 on success, -1 if there was nothing left to wait for.
+*/
+int			split_reap(t_pipex *pipex, t_split *sp);
+
+/**
+ * @brief Checks if the argument is a heredoc and sets the heredoc flag.
+ *
+ * @param arg Argument string.
+ * @param pipex Pointer to the pipex struct.
+*/
+int			check_and_set_heredoc(char *arg, t_pipex *pipex);
+
+/**
+ * @brief Opens the in-memory here_doc buffer.
+ *
+ * Backed by memfd_create, or directly by an anonymous file in the
+ * temporary directory when memfd is unavailable; nothing is created in
+ * the working directory.
+ *
+ * @param sink The sink to initialize.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, -1 on error.
+*/
+int			heredoc_sink_open(t_hdsink *sink, t_pipex *pipex);
+
+/**
+ * @brief Returns the directory for temporary data: --tmpdir, then
+ * $TMPDIR, then /tmp.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @return The directory.
+*/
+char		*temp_dir(t_pipex *pipex);
+
+/**
+ * @brief Opens an anonymous file in dir.
+ *
+ * Uses O_TMPFILE, or mkstemp followed by unlink on filesystems without
+ * it, so no path is ever left behind.
+ *
+ * @param dir Directory that will hold the data.
+ * @return The descriptor, or -1 on error.
+*/
+int			open_anon_file(char *dir);
+
+/**
+ * @brief Appends here_doc data to a sink, spilling it to disk if needed.
+ *
+ * @param sink The here_doc sink.
+ * @param buf Data to write.
+ * @param len Number of bytes.
+ * @return 0 on success, -1 on a write error.
+*/
+int			heredoc_write(t_hdsink *sink, const char *buf, size_t len);
+
+/**
+ * @brief Processes input for a heredoc.
+ *
+ * Prompts and reads line by line on a terminal; any other stdin goes
+ * through heredoc_bulk.
+ *
+ * @param limiter The limiter string.
+ * @param sink The sink to write to.
+*/
+void		process_heredoc_input(char *limiter, t_hdsink *sink);
+
+/**
+ * @brief Copies non-interactive here_doc input to a sink in large blocks.
+ *
+ * No prompts are written and no per-line work is done: each block is
+ * searched for "\nLIMITER\n" with memmem, keeping enough of its tail
+ * to catch a limiter split across reads, and written whole.
+ *
+ * @param limiter The limiter string.
+ * @param sink The sink to write to.
+*/
+void		heredoc_bulk(char *limiter, t_hdsink *sink);
+
+/**
+ * @brief Handles a heredoc.
+ *
+ * @param limiter The limiter string.
+ * @param pipex Pointer to the pipex struct.
+*/
+void		handle_heredoc(char *limiter, t_pipex *pipex);
+
+/**
+ * @brief Streams here_doc input into the first stage through a pipe.
+ *
+ * A feeder child strips the limiter and writes straight into the pipe
+ * whose read end becomes in_fd, so every stage starts at once and no
+ * temporary file is created.
+ *
+ * @param limiter The limiter string.
+ * @param pipex Pointer to the pipex struct.
+*/
+void		stream_heredoc(char *limiter, t_pipex *pipex);
+
+/**
+ * @brief Stops the here_doc feeder once the first stage has exited.
+ *
+ * Nothing can read its output any more, so a feeder blocked on the
+ * terminal would otherwise hold up the pipeline's exit.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param reaped Pid of the child that was just reaped.
+*/
+void		stop_heredoc_feeder(t_pipex *pipex, pid_t reaped);
+
+/**
+ * @brief Splits a command string into an argv, sh style.
+ *
+ * Handles single and double quotes, backslash escapes and empty
+ * arguments ('' or ""). The argv and all of its strings live in a
+ * single arena allocation, trimmed to the bytes actually used.
+ *
+ * @param arena The arena.
+ * @param cmd The command string.
+ * @param err Set to 1 on an unterminated quote, in which case the
+ * returned argv is empty.
+ * @return The argv, or NULL on allocation failure.
+*/
+char		**tokenize_cmd(t_arena *arena, const char *cmd, int *err);
+
+/**
+ * @brief Looks argv up in the builtin registry.
+ *
+ * @param argv The stage's argv.
+ * @return The registry index, or -1 if argv[0] is not a builtin or
+ * uses an option the builtin does not support.
+*/
+int			builtin_find(char **argv);
+
+/**
+ * @brief Returns the registry index of stage i: BI_FUSE for a stage
+ * the planner fused, otherwise what builtin_find says.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param i The stage index.
+ * @return The registry index, or -1 to run the real binary.
+*/
+int			builtin_stage(t_pipex *pipex, int i);
+
+/**
+ * @brief Parses one command of a fused stage.
+ *
+ * Only cat without operands, head, tr and sort -n/-r are taken, each
+ * as its builtin would parse it.
+ *
+ * @param argv The command's argv.
+ * @param args Receives the parsed arguments and their FUSE_* kind.
+ * @return 0 if the command can be fused, 1 otherwise.
+*/
+int			fuse_element(char **argv, t_bargs *args);
+
+/**
+ * @brief Parses a fused stage: its commands, one after another.
+ *
+ * @param argv The stage's argv, as the planner built it.
+ * @param args Receives the argv and the number of commands.
+ * @return 0 if every command can be fused, 1 otherwise.
+*/
+int			bi_fuse_parse(char **argv, t_bargs *args);
+
+/**
+ * @brief Runs a fused stage.
+ *
+ * sort followed by head keeps only head's count of lines; any other
+ * chain passes each block of stdin through every command in turn, in
+ * place, and stops reading once a head has printed all it will.
+ *
+ * @param args Parsed arguments.
+ * @return The exit status.
+*/
+int			bi_fuse(t_bargs *args);
+
+/**
+ * @brief Runs the current stage's builtin in the child, if it has one.
+ *
+ * Closes every descriptor above stderr first, since nothing will be
+ * closed by execve, then exits with the builtin's status. A builtin
+ * that returns BI_EXEC leaves the stage to the binary of that name
+ * found in PATH, which the caller then executes.
+ *
+ * @param pipex Pointer to the pipex struct.
+*/
+void		run_builtin(t_pipex *pipex);
+
+/**
+ * @brief read() that retries on EINTR.
+ *
+ * @param fd Descriptor to read.
+ * @param buf Destination.
+ * @param len Capacity of buf.
+ * @return Bytes read, 0 at end of file, -1 on error.
+*/
+ssize_t		bi_read(int fd, char *buf, size_t len);
+
+/**
+ * @brief Writes all of buf to stdout.
+ *
+ * @param buf Bytes to write.
+ * @param len Number of bytes.
+ * @return 0 on success, -1 on error.
+*/
+int			bi_write(const char *buf, size_t len);
+
+/**
+ * @brief Prints "name: what: strerror(errno)" like coreutils does.
+ *
+ * @param name Builtin name.
+ * @param what Object of the error, or NULL.
+ * @return Always 1.
+*/
+int			bi_fail(const char *name, const char *what);
+
+/**
+ * @brief Parses a plain decimal count.
+ *
+ * @param str The digits.
+ * @param out Receives the value.
+ * @return 0 on success, 1 for anything else (signs, suffixes, overflow).
+*/
+int			bi_number(const char *str, long long *out);
+
+/**
+ * @brief Returns the locale variable that decides a category.
+ *
+ * @param category The category's variable, such as "LC_CTYPE".
+ * @return The first non-empty of LC_ALL, category and LANG, or NULL.
+*/
+const char	*bi_locale(const char *category);
+
+/**
+ * @brief Checks whether the environment selects the C/POSIX locale.
+ *
+ * @return 1 if LC_ALL, LC_CTYPE or LANG resolve to C or POSIX, or are
+ * unset.
+*/
+int			bi_c_locale(void);
+
+/**
+ * @brief Checks whether the environment selects a UTF-8 locale.
+ *
+ * @return 1 if LC_ALL, LC_CTYPE or LANG resolve to a UTF-8 locale.
+*/
+int			bi_utf8_locale(void);
+
+/**
+ * @brief Checks str for UTF-8 encoding errors, as glibc's mbrlen sees
+ * them.
+ *
+ * @param str The bytes.
+ * @param len Length of str.
+ * @return 1 if str is valid UTF-8, 0 otherwise.
+*/
+int			bi_utf8_valid(const char *str, size_t len);
+
+/**
+ * @brief Parses cat arguments: file operands and "-" only.
+ *
+ * @param argv The stage's argv.
+ * @param args Receives the parsed arguments.
+ * @return 0 if every argument is supported, 1 to run the real binary.
+*/
+int			bi_cat_parse(char **argv, t_bargs *args);
+
+/**
+ * @brief cat: copies each operand, or stdin, to stdout.
+ *
+ * @param args Parsed arguments.
+ * @return The exit status.
+*/
+int			bi_cat(t_bargs *args);
+
+/**
+ * @brief Parses wc arguments: -l, -w and -c, on stdin only.
+ *
+ * -w is only handled in the C locale, where a word needs no decoding.
+ *
+ * @param argv The stage's argv.
+ * @param args Receives the parsed arguments.
+ * @return 0 if every argument is supported, 1 to run the real binary.
+*/
+int			bi_wc_parse(char **argv, t_bargs *args);
+
+/**
+ * @brief wc: counts lines, words and bytes of stdin.
+ *
+ * @param args Parsed arguments.
+ * @return The exit status.
+*/
+int			bi_wc(t_bargs *args);
+
+/**
+ * @brief Adds a block to the wc counts.
+ *
+ * Full 64-byte blocks go through the SIMD classifier when there is
+ * one, the rest byte by byte; both give coreutils' C-locale counts.
+ *
+ * @param wc Running counts.
+ * @param buf The block.
+ * @param len Block length.
+ * @param mode The requested counts; -c alone needs no scan.
+*/
+void		wc_count(t_wc *wc, const unsigned char *buf, size_t len,
+				int mode);
+
+/**
+ * @brief Picks the wc kernels for this CPU.
+ *
+ * AVX2 when cpuid reports it, otherwise SSE2, which every x86-64 has.
+ *
+ * @return The kernels, or NULL where only the scalar loop exists.
+*/
+const t_wcops	*wc_kernel(void);
+
+/**
+ * @brief Parses head/tail arguments: -n N, -c N and -N, on stdin only.
+ *
+ * @param argv The stage's argv.
+ * @param args Receives the parsed arguments.
+ * @return 0 if every argument is supported, 1 to run the real binary.
+*/
+int			bi_count_parse(char **argv, t_bargs *args);
+
+/**
+ * @brief head: prints the first count lines or bytes of stdin.
+ *
+ * @param args Parsed arguments.
+ * @return The exit status.
+*/
+int			bi_head(t_bargs *args);
+
+/**
+ * @brief Returns how much of a block head still prints.
+ *
+ * @param args Parsed arguments; count holds what is left to print.
+ * @param buf The block.
+ * @param len Block length.
+ * @return Number of leading bytes of buf to write.
+*/
+size_t		head_take(t_bargs *args, const char *buf, size_t len);
+
+/**
+ * @brief tail: prints the last count lines or bytes of stdin.
+ *
+ * @param args Parsed arguments.
+ * @return The exit status.
+*/
+int			bi_tail(t_bargs *args);
+
+/**
+ * @brief Parses tr arguments: [-d] [-s] SET1 [SET2].
+ *
+ * Sets may use ranges, [:class:] constructs and backslash escapes;
+ * repeats, equivalence classes and other options are left to the real
+ * tr.
+ *
+ * @param argv The stage's argv.
+ * @param args Receives the parsed arguments.
+ * @return 0 if every argument is supported, 1 to run the real binary.
+*/
+int			bi_tr_parse(char **argv, t_bargs *args);
+
+/**
+ * @brief tr: translates, deletes or squeezes bytes of stdin.
+ *
+ * Runs as a fused stage of one command.
+ *
+ * @param args Parsed arguments.
+ * @return The exit status.
+*/
+int			bi_tr(t_bargs *args);
+
+/**
+ * @brief Precomputes what the SIMD kernels need from the tr tables.
+ *
+ * @param args Parsed arguments.
+*/
+void		tr_plan(t_bargs *args);
+
+/**
+ * @brief Translates, deletes and squeezes one block in place.
+ *
+ * @param args Parsed arguments, with tr_plan done.
+ * @param ops The SIMD kernels, or NULL.
+ * @param buf The bytes.
+ * @param len Length of buf.
+ * @return The new length.
+*/
+size_t		tr_block(t_bargs *args, const t_trops *ops, unsigned char *buf,
+				size_t len);
+
+/**
+ * @brief Parses sort arguments for the top-K builtin: -n and -r only.
+ *
+ * @param argv The command's argv.
+ * @param args Receives the SORT_* flags in mode.
+ * @return 0 if every argument is supported, 1 otherwise.
+*/
+int			bi_sort_parse(char **argv, t_bargs *args);
+
+/**
+ * @brief Compares two lines as GNU sort does in the C locale.
+ *
+ * With SORT_NUM the leading numbers are compared first; ties, and
+ * every line without it, fall back to comparing the bytes.
+ *
+ * @param mode The SORT_* flags.
+ * @param a First line, NUL-terminated.
+ * @param b Second line, NUL-terminated.
+ * @return Negative, 0 or positive as a sorts before, with or after b.
+*/
+int			sort_cmp(int mode, const t_sline *a, const t_sline *b);
+
+/**
+ * @brief Offers a line to the top-K heap, copying it if it is kept.
+ *
+ * @param t The heap.
+ * @param s The line, NUL-terminated.
+ * @param len Its length.
+ * @return 0 on success, -1 on allocation failure.
+*/
+int			topk_push(t_topk *t, unsigned char *s, size_t len);
+
+/**
+ * @brief Sorts the kept lines in place, first to last, undoing the heap.
+ *
+ * @param t The heap.
+*/
+void		topk_order(t_topk *t);
+
+/**
+ * @brief sort | head -n K: keeps the first K lines of sorted stdin in
+ * a heap instead of sorting all of it.
+ *
+ * @param sort The sort command's arguments.
+ * @param k Lines to print.
+ * @return The exit status.
+*/
+int			bi_topk(t_bargs *sort, long long k);
+
+/**
+ * @brief Expands a tr set: escapes, a-z ranges and [:class:] constructs.
+ *
+ * @param s The set as written.
+ * @param out Receives the expanded characters.
+ * @param len Receives the number of characters.
+ * @return 0 on success, 1 for syntax left to the real tr.
+*/
+int			tr_expand(const char *s, unsigned char *out, int *len);
+
+/**
+ * @brief Looks up a character class by name.
+ *
+ * @param name The class name, such as "alpha"; not terminated.
+ * @param n Length of name.
+ * @return Its <ctype.h> function, or NULL for an unknown name.
+*/
+t_ctype		bi_ctype(const char *name, size_t n);
+
+/**
+ * @brief Picks the tr kernels for this CPU: AVX2, SSSE3 or none.
+ *
+ * @return The kernels, or NULL to use the tables alone.
+*/
+const t_trops	*tr_kernel(void);
+
+/**
+ * @brief Fills ops with the AVX2 tr kernels; x86-64 only.
+ *
+ * @param ops The kernel table.
+*/
+void		tr_kernel_avx2(t_trops *ops);
+
+/**
+ * @brief Parses grep arguments: [-vciFGE] [-m N] [-e PAT]... [-f FILE]
+ * [PATTERNS], reading stdin.
+ *
+ * Without -F, patterns must hold no regex operator. -i needs the C
+ * locale, and patterns must be valid UTF-8 in a UTF-8 locale; other
+ * locales, options and file operands are left to the real grep.
+ *
+ * @param argv The stage's argv.
+ * @param args Receives the parsed arguments.
+ * @return 0 if every argument is supported, 1 to run the real binary.
+*/
+int			bi_grep_parse(char **argv, t_bargs *args);
+
+/**
+ * @brief grep: prints, or counts, the lines of stdin that match.
+ *
+ * Binary input goes to the real grep, see grep_hold_start.
+ *
+ * @param args Parsed arguments.
+ * @return 0 if a line was selected, 1 if none, 2 on error, or BI_EXEC
+ * to run the real grep.
+*/
+int			bi_grep(t_bargs *args);
+
+/**
+ * @brief Reads a whole file into memory.
+ *
+ * @param path The file.
+ * @param len Receives its size.
+ * @return The NUL-terminated contents, or NULL on error.
+*/
+char		*grep_load(const char *path, size_t *len);
+
+/**
+ * @brief Doubles a buffer.
+ *
+ * @param buf The buffer; freed.
+ * @param len Bytes of buf to keep.
+ * @param cap Its capacity; doubled. One more byte is allocated.
+ * @return The new buffer, or NULL on allocation failure.
+*/
+char		*grep_grow(char *buf, size_t len, size_t *cap);
+
+/**
+ * @brief Joins the -e patterns, the PATTERNS operand and the -f file.
+ *
+ * Each pattern ends in a newline in text. A -f file adds its lines; an
+ * -e argument adds one pattern per line, even an empty last one.
+ *
+ * @param args Parsed arguments.
+ * @param g The grep state; receives text and len.
+ * @return 0 on success, -1 on error.
+*/
+int			grep_join(t_bargs *args, t_grep *g);
+
+/**
+ * @brief Collects and compiles the grep patterns.
+ *
+ * @param args Parsed arguments.
+ * @param g The grep state to fill.
+ * @return 0 on success, -1 on allocation failure.
+*/
+int			grep_setup(t_bargs *args, t_grep *g);
+
+/**
+ * @brief Frees what grep_setup allocated.
+ *
+ * @param g The grep state.
+*/
+void		grep_free(t_grep *g);
+
+/**
+ * @brief Starts holding grep's output back until its input is known to
+ * hold no NUL byte.
+ *
+ * A regular stdin with a hole reads as NULs, so it goes straight to
+ * the real grep.
+ *
+ * @param g The grep state.
+ * @return 0, or GREP_REAL to hand the stage over now.
+*/
+int			grep_hold_start(t_grep *g);
+
+/**
+ * @brief Keeps a copy of bytes read from a stdin that cannot be
+ * rewound, up to GREP_HOLD of them; past that the output is released.
+ *
+ * @param g The grep state.
+ * @param p Bytes just read.
+ * @param n Length of p.
+ * @return 0 on success, -1 on a write error.
+*/
+int			grep_hold(t_grep *g, const unsigned char *p, size_t n);
+
+/**
+ * @brief Stops holding the output back.
+ *
+ * The rest of a regular stdin is checked for a NUL first, without
+ * moving its offset; for any other stdin the output kept in hout is
+ * written.
+ *
+ * @param g The grep state.
+ * @return 0 on success, -1 on a write error, or 1 if a NUL lies ahead,
+ * or it could not be checked, so the stage must go to the real grep.
+*/
+int			grep_release(t_grep *g);
+
+/**
+ * @brief Makes room for a line while the output is held and out is
+ * full.
+ *
+ * For a stdin that cannot be rewound, out and the line move to hout;
+ * the output is made of input lines, so it only outgrows GREP_HOLD
+ * along with the replay, and is then released. A regular stdin is
+ * released right away.
+ *
+ * @param g The grep state.
+ * @param line The line, with its newline.
+ * @param n Length of line.
+ * @return 0 once the line is kept, 1 if it must be written as usual,
+ * -1 on a write error, GREP_REAL to hand the stage over.
+*/
+int			grep_spill(t_grep *g, const unsigned char *line, size_t n);
+
+/**
+ * @brief Hands the stage to the real grep with the input it started
+ * with.
+ *
+ * A regular stdin is rewound. Otherwise the process forks: the child
+ * reads a pipe and runs the real grep, and the parent writes the
+ * replay and the rest of stdin into it and waits for the child.
+ *
+ * @param g The grep state.
+ * @return BI_EXEC where the real grep must run, otherwise the exit
+ * status of the stage.
+*/
+int			grep_handoff(t_grep *g);
+
+/**
+ * @brief Finds a pattern in buf.
+ *
+ * @param g The grep state.
+ * @param buf The bytes; patterns never span a newline.
+ * @param len Length of buf.
+ * @return The offset of a byte of the first match, or len if none.
+*/
+size_t		grep_find(const t_grep *g, const unsigned char *buf, size_t len);
+
+/**
+ * @brief Checks whether the single pattern starts at p.
+ *
+ * @param g The grep state.
+ * @param p At least plen readable bytes.
+ * @return 1 on a match, 0 otherwise.
+*/
+int			grep_verify(const t_grep *g, const unsigned char *p);
+
+/**
+ * @brief Finds the single pattern one byte at a time.
+ *
+ * @param g The grep state.
+ * @param buf The bytes.
+ * @param len Length of buf.
+ * @return The offset of the match, or len if none.
+*/
+size_t		grep_scan(const t_grep *g, const unsigned char *buf, size_t len);
+
+/**
+ * @brief Picks the single-pattern kernel for this CPU: AVX2 or SSE2.
+ *
+ * @return The kernel, or NULL to use grep_scan.
+*/
+const t_grepops	*grep_kernel(void);
+
+/**
+ * @brief Builds the Aho-Corasick automaton of a pattern list.
+ *
+ * @param g The grep state, with text and npats set.
+ * @return 0 on success, -1 on allocation failure or a too large list.
+*/
+int			grep_ac_build(t_grep *g);
+
+/**
+ * @brief Runs the Aho-Corasick automaton over buf.
+ *
+ * @param g The grep state.
+ * @param buf The bytes.
+ * @param len Length of buf.
+ * @return The offset of the last byte of the first match, or len.
+*/
+size_t		grep_ac_find(const t_grep *g, const unsigned char *buf,
+				size_t len);
+
+/**
+ * @brief Searches buf with the regex DFA, first skipping to the lines
+ * that contain the must string when there is one.
+ *
+ * Once GREP_DENSE lines in a row contain it, the prefilter skips
+ * nothing, so the DFA runs over the rest of the input on its own.
+ *
+ * @param g The grep state.
+ * @param buf Whole lines, the last one ending in a newline.
+ * @param len Length of buf.
+ * @return An offset within the first matching line, or len.
+*/
+size_t		grep_dfa_find(const t_grep *g, const unsigned char *buf,
+				size_t len);
+
+/**
+ * @brief Resets a regex automaton before parsing.
+ *
+ * @param d The automaton.
+ * @param flags The GREP_* flags: GREP_EXT for ERE, GREP_ICASE.
+ * @param utf8 1 outside the C locale, where only ASCII patterns without
+ * ., negated brackets, classes or \w-style escapes are accepted.
+*/
+void		grep_rx_init(t_grepdfa *d, int flags, int utf8);
+
+/**
+ * @brief Parses newline-separated patterns and adds them to the
+ * alternation of the automaton.
+ *
+ * @param d The automaton.
+ * @param text The patterns.
+ * @param len Length of text.
+ * @return 0 on success, -1 for syntax left to the real grep.
+*/
+int			grep_rx_parse(t_grepdfa *d, const char *text, size_t len);
+
+/**
+ * @brief Compiles the patterns of g into its DFA and replaces text by
+ * their must string.
+ *
+ * @param g The grep state, with text and len set.
+ * @return 0 on success, -1 on allocation failure.
+*/
+int			grep_rx_compile(t_grep *g);
+
+/**
+ * @brief Returns the next regex token without consuming it.
+ *
+ * @param ps The parser.
+ * @param len Receives the token's length in the pattern.
+ * @return A literal byte, an RX_* token, RX_EOF or RX_ERR.
+*/
+int			rx_peek(const t_rxparse *ps, int *len);
+
+/**
+ * @brief Parses the bounds of an interval, {n}, {n,}, {,m} or {n,m}.
+ *
+ * @param ps The parser, after the opening brace; advanced past the
+ * closing one.
+ * @param lo Receives the minimum.
+ * @param hi Receives the maximum, or -1 for none.
+ * @return 0 on success, -1 for an invalid or too large interval.
+*/
+int			rx_bound(t_rxparse *ps, int *lo, int *hi);
+
+/**
+ * @brief Parses a bracket expression into a byte set.
+ *
+ * @param ps The parser, after the opening bracket; advanced past the
+ * closing one.
+ * @param set The byte set.
+ * @return 1 if it is negated, 0 if not, -1 otherwise.
+*/
+int			rx_bracket(t_rxparse *ps, uint64_t *set);
+
+/**
+ * @brief Builds the byte set of a literal, ., bracket or \w-style atom.
+ *
+ * The set is folded with -i, then complemented if negated; the newline
+ * is never in it.
+ *
+ * @param ps The parser, after the token.
+ * @param tok The token.
+ * @param set Receives the 256-bit set.
+ * @return 0 on success, -1 otherwise.
+*/
+int			rx_set(t_rxparse *ps, int tok, uint64_t *set);
+
+/**
+ * @brief Adds a position to the automaton.
+ *
+ * @param d The automaton.
+ * @param kind 0 for a byte set, RX_BOL, RX_EOL or RX_EOF.
+ * @param set The byte set, or NULL.
+ * @param f Receives a fragment made of the position alone.
+ * @return 0 on success, -1 past GREP_POS positions.
+*/
+int			rx_pos(t_grepdfa *d, int kind, const uint64_t *set,
+				t_rxfrag *f);
+
+/**
+ * @brief Lets every position of to follow every position of from.
+ *
+ * @param d The automaton.
+ * @param from Position set.
+ * @param to Position set.
+*/
+void		rx_link(t_grepdfa *d, const uint64_t *from, const uint64_t *to);
+
+/**
+ * @brief Concatenates b to a.
+ *
+ * @param d The automaton.
+ * @param a First fragment; receives the result.
+ * @param b Second fragment.
+*/
+void		rx_cat(t_grepdfa *d, t_rxfrag *a, const t_rxfrag *b);
+
+/**
+ * @brief Makes a the alternation of a and b.
+ *
+ * @param a First fragment; receives the result.
+ * @param b Second fragment.
+*/
+void		rx_union(t_rxfrag *a, const t_rxfrag *b);
+
+/**
+ * @brief Tracks the longest literal run of a top-level pattern.
+ *
+ * @param ps The parser.
+ * @param c The byte to append, or a value above 255 for none.
+ * @param brk 1 if the run ends after c.
+*/
+void		rx_must(t_rxparse *ps, int c, int brk);
+
+/**
+ * @brief Parses an atom and its quantifiers.
+ *
+ * @param ps The parser.
+ * @param f Receives the piece.
+ * @param s Start of the piece.
+ * @param stop Where quantifiers stop being read: the end of the
+ * pattern, or the interval whose copy this is.
+ * @return The byte of a one-byte literal, another RX_* token for other
+ * atoms, or RX_ERR.
+*/
+int			rx_piece(t_rxparse *ps, t_rxfrag *f, const unsigned char *s,
+				const unsigned char *stop);
+
+/**
+ * @brief Parses an alternation of concatenations.
+ *
+ * @param ps The parser.
+ * @param f Receives the alternation.
+ * @return 0 on success, -1 otherwise.
+*/
+int			rx_alt(t_rxparse *ps, t_rxfrag *f);
+
+/**
+ * @brief Adds the positions that the anchors allow to a set.
+ *
+ * @param d The automaton.
+ * @param set The positions; updated.
+ * @param bol 1 at the start of a line.
+ * @param eol 1 at the end of a line.
+ * @return 1 if the set includes the final position, 0 otherwise.
+*/
+int			grep_dfa_close(const t_grepdfa *d, uint64_t *set, int bol,
+				int eol);
+
+/**
+ * @brief Collects the bytes that leave the idle state and picks the
+ * kernel that finds them.
+ *
+ * @param d The automaton, with its positions built.
+*/
+void		grep_dfa_seekset(t_grepdfa *d);
+
+/**
+ * @brief Builds and caches the transition of state s on class c.
+ *
+ * @param d The automaton.
+ * @param s Offset of the state in next.
+ * @param c The byte class.
+ * @return The next state's offset, -2 for a match or -3 for the idle
+ * state.
+*/
+int32_t		grep_dfa_step(t_grepdfa *d, int32_t s, int c);
+
+/**
+ * @brief Runs the DFA over whole lines from the start state.
+ *
+ * @param d The automaton.
+ * @param buf Whole lines, the last one ending in a newline.
+ * @param len Length of buf.
+ * @return The offset where the first match was seen, or len.
+*/
+size_t		grep_dfa_run(t_grepdfa *d, const unsigned char *buf, size_t len);
+
+/**
+ * @brief Prints the -c count, flushes the output and reports binary
+ * input.
+ *
+ * @param g The grep state.
+ * @param ret 0 or 1 after a search, -1 after a write error, -2 after a
+ * read or allocation error.
+ * @return The exit status.
+*/
+int			grep_finish(t_grep *g, int ret);
+
+/**
+ * @brief Selects the matching, or with -v the other, lines of buf.
+ *
+ * @param g The grep state.
+ * @param buf Whole lines, the last one ending in a newline.
+ * @param len Length of buf.
+ * @return 0 to go on, 1 when done (-m reached or binary input), -1 on
+ * a write error, GREP_REAL to hand the stage to the real grep.
+*/
+int			grep_lines(t_grep *g, const unsigned char *buf, size_t len);
+
+/**
+ * @brief Parses commands for the pipex program.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param argv Argument vector.
+*/
+void		parse_cmds(t_pipex *pipex, char **argv);
+
+/**
+ * @brief Runs a plan reduced to a lone cat in the parent: FICLONE, then
+ * copy_file_range over the data extents between regular files, else
+ * splice through a pipe.
+ *
+ * On a copy error the message is printed and copy_status set to 1.
+ *
+ * @param pipex Pointer to the pipex struct, with the files open.
+ * @return 1 if the copy ran, 0 if the pipeline must run as usual.
+*/
+int			copy_passthrough(t_pipex *pipex);
+
+/**
+ * @brief Appends the whole of a file to out, at out's file position,
+ * with copy_file_range, or splice when the kernel cannot.
+ *
+ * @param in The file to copy.
+ * @param out The destination.
+ * @return 0 on success, -1 on error.
+*/
+int			copy_append(int in, int out);
+
+/**
+ * @brief Rewrites the stage list before anything runs.
+ *
+ * Drops cat stages that only copy their input, turns sort | head into
+ * a top-K builtin and fuses adjacent tr, head and cat stages into one.
+ * Sets passthrough when what is left is a lone cat.
+ * With --explain, prints the plan before and after, and why each rule
+ * fired or not.
+ *
+ * @param pipex Pointer to the pipex struct, with the commands parsed.
+ * @param infile_ok 1 if the first stage's input could be opened.
+*/
+void		plan_optimize(t_pipex *pipex, int infile_ok);
+
+/**
+ * @brief Handles --explain: prints the plan and the optimized plan
+ * without opening the outfile or running anything.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param ac Argument count.
+ * @param av Argument vector.
+ * @return The exit status, 0.
+*/
+int			plan_explain(t_pipex *pipex, int ac, char **av);
+
+/**
+ * @brief Starts a plan from the parsed commands: one command per
+ * stage, in command-line order.
+ *
+ * @param p The plan.
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, -1 on allocation failure.
+*/
+int			plan_init(t_plan *p, t_pipex *pipex);
+
+/**
+ * @brief Removes stage i from the plan.
+ *
+ * @param p The plan.
+ * @param i The stage.
+*/
+void		plan_drop(t_plan *p, int i);
+
+/**
+ * @brief Joins stages i and i + 1 into one fused stage.
+ *
+ * @param p The plan.
+ * @param i The first stage.
+ * @return 0 on success, -1 on allocation failure.
+*/
+int			plan_join(t_plan *p, int i);
+
+/**
+ * @brief Checks whether the cat at stage i can be dropped.
+ *
+ * The last stage is kept: its exit status is the pipeline's. So is a
+ * first cat whose infile cannot be opened, because the next stage
+ * would then not run at all, or whose next stage is not a cat, head,
+ * tr or sort fuse_element takes: others, such as wc sizing its columns
+ * from a regular stdin, may print differently once they read the
+ * infile itself.
+ *
+ * @param p The plan.
+ * @param i The cat stage.
+ * @param rule Receives the rule's name: infile-direct for the first
+ * stage, drop-cat for the others.
+ * @return NULL if it can, otherwise why not.
+*/
+const char	*plan_cat(t_plan *p, int i, const char **rule);
+
+/**
+ * @brief Checks whether stage i can join a fused block loop.
+ *
+ * @param p The plan.
+ * @param i The stage.
+ * @return NULL if it can, otherwise why not.
+*/
+const char	*plan_filter(t_plan *p, int i);
+
+/**
+ * @brief Checks whether the sort at stage i and the next stage can run
+ * as the top-K builtin.
+ *
+ * @param p The plan.
+ * @param i The sort stage.
+ * @return NULL if they can, otherwise why not.
+*/
+const char	*plan_topk(t_plan *p, int i);
+
+/**
+ * @brief Checks whether the optimized plan is a lone cat, which the
+ * parent can run as a kernel copy instead of a process.
+ *
+ * @param p The plan, with every rule applied.
+ * @param pipex Pointer to the pipex struct.
+ * @return NULL if it is, otherwise why not.
+*/
+const char	*plan_copy(t_plan *p, t_pipex *pipex);
+
+/**
+ * @brief Prints one rule decision, with --explain.
+ *
+ * @param p The plan.
+ * @param rule The rule's name.
+ * @param fired 1 if the rule rewrote the plan.
+ * @param fmt printf format of the reason.
+*/
+void		plan_log(t_plan *p, const char *rule, int fired,
+				const char *fmt, ...);
+
+/**
+ * @brief Prints the stage list, with --explain.
+ *
+ * @param p The plan.
+ * @param title Heading of the list.
+*/
+void		plan_print(t_plan *p, const char *title);
+
+/**
+ * @brief 64-bit FNV-1a hash, never 0.
+ *
+ * @param str Bytes to hash.
+ * @param len Number of bytes.
+ * @return The hash.
+*/
+uint64_t	fnv1a(const char *str, size_t len);
+
+/**
+ * @brief Looks a command name up in the path cache.
+ *
+ * @param pc The path cache.
+ * @param name Command name.
+ * @return The cached path, or NULL on a miss.
+*/
+char		*pcache_lookup(t_pcache *pc, const char *name);
+
+/**
+ * @brief Records the resolved path of a command.
+ *
+ * Names or paths too long for a slot are not cached. The table is
+ * cleared once it is three quarters full.
+ *
+ * @param pc The path cache.
+ * @param name Command name.
+ * @param path Resolved path.
+*/
+void		pcache_insert(t_pcache *pc, const char *name, const char *path);
+
+/**
+ * @brief Resolves a slash-less command name through the path cache.
+ *
+ * A hit costs no filesystem access; a miss searches PATH and records
+ * the result.
+ *
+ * @param pc The path cache.
+ * @param paths PATH split into directories.
+ * @param cmd Command name.
+ * @param buf PATH_MAX bytes used to build candidate paths.
+ * @return The cached path or buf, or NULL if the command was not found.
+*/
+char		*pcache_resolve(t_pcache *pc, char **paths, char *cmd, char *buf);
+
+/**
+ * @brief Finds the path of a command in the given paths.
+ *
+ * Candidates are built in buf, so the search allocates nothing.
+ *
+ * @param paths The paths to search.
+ * @param cmd The command to find.
+ * @param buf PATH_MAX bytes that receive the path.
+ * @return buf, or NULL if not found.
+*/
+char		*find_command_path(char **paths, char *cmd, char *buf);
+
+/**
+ * @brief Joins a directory path with a command.
+ *
+ * @param dir The directory path.
+ * @param cmd The command to join.
+ * @param buf PATH_MAX bytes that receive the path.
+ * @return buf, or NULL if the path does not fit.
+*/
+char		*join_path_cmd(char *dir, char *cmd, char *buf);
+
+/**
+ * @brief Opens every PATH directory and indexes its entries.
+ *
+ * An index already built by load_paths is kept.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param paths PATH split into directories.
+ * @return 0 on success, -1 on allocation failure.
+*/
+int			pidx_build(t_pipex *pipex, char **paths);
+
+/**
+ * @brief Resolves the command of stage i through the PATH index.
+ *
+ * A single faccessat against the matching directory replaces the
+ * access() probe of every PATH entry.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param paths PATH split into directories.
+ * @param i Stage index.
+ * @param buf PATH_MAX bytes that receive the path.
+ * @return buf, or NULL if the command was not found.
+*/
+char		*pidx_resolve(t_pipex *pipex, char **paths, int i, char *buf);
+
+/**
+ * @brief Opens the stage's command relative to its PATH directory fd,
+ * for execveat(AT_EMPTY_PATH).
+ *
+ * The kernel starts scripts as /dev/fd/N, which their interpreter must
+ * open after exec, so for "#!" files the fd is kept across exec. Other
+ * commands never see it. A command that cannot be read is opened with
+ * O_PATH, which is enough to exec a binary.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @return The descriptor of the stage's command, or -1 on error.
+*/
+int			pidx_exec_fd(t_pipex *pipex);
+
+/**
+ * @brief Makes room in the name pool of the PATH index for a name of
+ * len bytes and its NUL.
+ *
+ * @param idx The PATH index.
+ * @param len Length of the name.
+ * @return 0 on success, -1 on allocation failure.
+*/
+int			pidx_pool(t_pathidx *idx, size_t len);
+
+/**
+ * @brief Frees the name table of the PATH index, keeping its fds.
+ *
+ * @param idx The PATH index.
+*/
+void		pidx_free_table(t_pathidx *idx);
+
+/**
+ * @brief Closes the PATH directory fds and frees the index.
+ *
+ * @param pipex Pointer to the pipex struct.
+*/
+void		pidx_free(t_pipex *pipex);
+
+/**
+ * @brief Computes the header a valid cache must have for this PATH.
+ *
+ * @param pc The path cache.
+ * @param path_env Value of PATH.
+ * @param paths PATH split into directories.
+ * @return 0 on success, -1 if PATH has more than PCACHE_DIRS entries.
+*/
+int			pcache_fill_header(t_pcache *pc, const char *path_env,
+				char **paths);
+
+/**
+ * @brief Opens the path cache if --path-cache is set.
+ *
+ * Maps the cache file when it is valid for the current PATH, otherwise
+ * starts from an empty table.
+ *
+ * @param pc The path cache.
+ * @param pipex Pointer to the pipex struct.
+ * @param path_env Value of PATH.
+ * @param paths PATH split into directories.
+ * @return 0 if the cache is usable, -1 otherwise.
+*/
+int			pcache_open(t_pcache *pc, t_pipex *pipex, char *path_env,
+				char **paths);
+
+/**
+ * @brief Saves the path cache if it changed and releases it.
+ *
+ * @param pc The path cache.
+*/
+void		pcache_close(t_pcache *pc);
+
+/**
+ * @brief Allocates cmd_paths, cmd_dirs with --path-index and, unless
+ * --no-builtins, cmd_builtin.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, -1 on allocation failure.
+*/
+int			resolve_init(t_pipex *pipex);
+
+/**
+ * @brief Resolves the command of stage i.
+ *
+ * Builtins are checked first. Then the PATH index or the path cache
+ * is used when open; otherwise the name is tried as given, then in
+ * every PATH directory.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param paths PATH split into directories.
+ * @param pc The path cache, or NULL.
+ * @param i Stage index.
+ * @return The path, copied into the arena, or NULL if not found.
+*/
+char		*resolve_command(t_pipex *pipex, char **paths, t_pcache *pc,
+				int i);
+
+/**
+ * @brief Resolves the command of every stage into cmd_paths.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param paths PATH split into directories.
+ * @param pc The path cache, or NULL.
+*/
+void		resolve_command_paths(t_pipex *pipex, char **paths,
+				t_pcache *pc);
+
+/**
+ * @brief With --lazy-resolve, resolves the current stage in its child.
+ *
+ * Runs after fork, so the lookups of all stages overlap and the first
+ * stage starts without waiting for the others. A miss leaves
+ * cmd_paths[idx] NULL for handle_child_error.
+ *
+ * @param pipex Pointer to the pipex struct.
+*/
+void		resolve_in_child(t_pipex *pipex);
+
+/**
+ * @brief Parses paths for the pipex program.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param envp Environment variables.
+*/
+void		parse_paths(t_pipex *pipex, char **envp);
+
+/**
+ * @brief Splits PATH ahead of the pipelines that will use it and, with
+ * --path-index, reads its directories; parse_paths keeps both.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param envp Environment variables.
+*/
+void		load_paths(t_pipex *pipex, char **envp);
+
+/**
+ * @brief Safely closes a file descriptor and sets it to -1.
  *
  * @param fd Pointer to the file descriptor to close.
  */
 void		safe_close(int *fd);
 
 /**
- * @brief Removes the heredoc temporary file if here_doc mode is active.
+ * @brief Releases the PATH list, command paths and argument arrays.
+ *
+ * They all live in the pipex arena, so this is a single reset.
  *
  * @param pipex Pointer to the pipex struct.
  */
-void		cleanup_heredoc(t_pipex *pipex);
+void		free_parsed(t_pipex *pipex);
 
 /**
- * @brief Frees memory allocated for command paths in the pipex struct.
+ * @brief Returns size bytes from the arena, 16-byte aligned.
  *
- * @param pipex Pointer to the pipex struct.
+ * @param arena The arena.
+ * @param size Number of bytes.
+ * @return The memory, or NULL on allocation failure.
  */
-void		free_cmd_paths(t_pipex *pipex);
+void		*arena_alloc(t_arena *arena, size_t size);
 
 /**
- * @brief Frees memory allocated for command arguments in the pipex struct.
+ * @brief Copies a string into the arena.
  *
- * @param pipex Pointer to the pipex struct.
+ * @param arena The arena.
+ * @param str The string to copy.
+ * @return The copy, or NULL on allocation failure.
+ */
+char		*arena_strdup(t_arena *arena, const char *str);
+
+/**
+ * @brief Gives back the unused tail of the last allocation.
+ *
+ * @param arena The arena.
+ * @param ptr The last allocation.
+ * @param end First byte of ptr that is not needed.
+ */
+void		arena_shrink(t_arena *arena, void *ptr, void *end);
+
+/**
+ * @brief Frees every block of the arena.
+ *
+ * In a PIPEX_DEBUG build, reports the arena counters first.
+ *
+ * @param arena The arena.
+ */
+void		arena_reset(t_arena *arena);
+
+/**
+ * @brief Prints the allocation counters of the arena to stderr.
+ *
+ * @param arena The arena.
  */
-void		free_cmd_args(t_pipex *pipex);
+void		arena_report(t_arena *arena);
 
 /**
  * @brief Frees all resources allocated in the pipex
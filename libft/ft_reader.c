@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_reader.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:11:53 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/17 23:11:53 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+int	ft_reader_init(t_reader *rd, int fd)
+{
+	rd->fd = fd;
+	rd->eof = 0;
+	rd->cap = READER_SIZE;
+	rd->start = 0;
+	rd->scan = 0;
+	rd->end = 0;
+	rd->buf = malloc(rd->cap);
+	if (!rd->buf)
+		return (-1);
+	return (0);
+}
+
+/**
+ * Make room at the end of the buffer: slide the unconsumed bytes to the
+ * front, or double the capacity when they already fill it
+ * @param rd The reader
+ * @return 0 on success, -1 if the buffer could not be grown
+ */
+static int	reader_make_room(t_reader *rd)
+{
+	char	*grown;
+
+	if (rd->start > 0)
+	{
+		ft_memmove(rd->buf, rd->buf + rd->start, rd->end - rd->start);
+		rd->end -= rd->start;
+		rd->scan -= rd->start;
+		rd->start = 0;
+		return (0);
+	}
+	grown = malloc(rd->cap * 2);
+	if (!grown)
+		return (-1);
+	ft_memcpy(grown, rd->buf, rd->end);
+	free(rd->buf);
+	rd->buf = grown;
+	rd->cap *= 2;
+	return (0);
+}
+
+ssize_t	ft_reader_fill(t_reader *rd)
+{
+	ssize_t	bytes_read;
+
+	if (rd->end == rd->cap && reader_make_room(rd) < 0)
+		return (-1);
+	bytes_read = read(rd->fd, rd->buf + rd->end, rd->cap - rd->end);
+	if (bytes_read == 0)
+		rd->eof = 1;
+	if (bytes_read > 0)
+		rd->end += bytes_read;
+	return (bytes_read);
+}
+
+int	ft_reader_line(t_reader *rd, t_line *line)
+{
+	char	*nl;
+
+	while (1)
+	{
+		nl = memchr(rd->buf + rd->scan, '\n', rd->end - rd->scan);
+		if (nl || (rd->eof && rd->end > rd->start))
+		{
+			line->ptr = rd->buf + rd->start;
+			rd->scan = rd->end;
+			if (nl)
+				rd->scan = nl - rd->buf + 1;
+			line->len = rd->scan - rd->start;
+			rd->start = rd->scan;
+			return (1);
+		}
+		rd->scan = rd->end;
+		if (rd->eof)
+			return (0);
+		if (ft_reader_fill(rd) < 0)
+			return (-1);
+	}
+}
+
+void	ft_reader_free(t_reader *rd)
+{
+	free(rd->buf);
+	rd->buf = NULL;
+	rd->cap = 0;
+	rd->start = 0;
+	rd->scan = 0;
+	rd->end = 0;
+}
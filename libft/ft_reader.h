@@ -0,0 +1,81 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_reader.h                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:11:53 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/17 23:11:53 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_READER_H
+# define FT_READER_H
+
+# include <stdlib.h>
+# include <string.h>
+# include <unistd.h>
+
+# ifndef READER_SIZE
+#  define READER_SIZE 65536
+# endif
+
+/**
+ * Buffered reader over a file descriptor.
+ * Unconsumed bytes live in buf[start, end); bytes before scan are known
+ * to contain no newline. The buffer is compacted or doubled only when it
+ * is full, so every input byte is read, searched and moved O(1) times.
+ */
+typedef struct s_reader
+{
+	int		fd;
+	int		eof;
+	char	*buf;
+	size_t	cap;
+	size_t	start;
+	size_t	scan;
+	size_t	end;
+}			t_reader;
+
+/**
+ * A length-tracked view into a reader's buffer. It may contain NUL
+ * bytes, is not NUL terminated, and stays valid until the next call on
+ * the same reader.
+ */
+typedef struct s_line
+{
+	char	*ptr;
+	size_t	len;
+}			t_line;
+
+/**
+ * Initialize a reader on any file descriptor
+ * @param rd The reader to initialize
+ * @param fd The file descriptor to read from
+ * @return 0 on success, -1 if the buffer could not be allocated
+ */
+int		ft_reader_init(t_reader *rd, int fd);
+
+/**
+ * Read more data into the reader, compacting or growing the buffer
+ * @param rd The reader
+ * @return Number of bytes read, 0 at end of file, -1 on error
+ */
+ssize_t	ft_reader_fill(t_reader *rd);
+
+/**
+ * Return the next line, including its '\n' when present
+ * @param rd The reader
+ * @param line Receives a view of the line
+ * @return 1 if a line was returned, 0 at end of file, -1 on error
+ */
+int		ft_reader_line(t_reader *rd, t_line *line);
+
+/**
+ * Release the reader's buffer (the descriptor is not closed)
+ * @param rd The reader
+ */
+void	ft_reader_free(t_reader *rd);
+
+#endif
@@ -6,7 +6,7 @@
 /*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/02/05 13:48:44 by dancuenc          #+#    #+#             */
-/*   Updated: 2025/03/28 16:31:57 by dancuenc         ###   ########.fr       */
+/*   Updated: 2026/10/17 23:11:53 by dancuenc         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,12 +19,10 @@
 # include <stdio.h>
 # include "libft.h"
 
-# ifndef BUFFER_SIZE
-#  define BUFFER_SIZE 42
-# endif
-
 /**
  * Read a line from a file descriptor
+ * Built on a per-fd t_reader, so it works for any fd and runs in linear
+ * time; new code should use ft_reader_line directly to avoid the copy.
  * @param fd The file descriptor to read from
  * @return A pointer to the line read, or NULL if an error occurred
  */
@@ -6,7 +6,7 @@
 /*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/01/15 12:24:52 by dancuenc          #+#    #+#             */
-/*   Updated: 2025/07/10 13:17:44 by dancuenc         ###   ########.fr       */
+/*   Updated: 2026/10/17 23:11:53 by dancuenc         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,6 +19,7 @@
 # include <unistd.h>
 # include <limits.h>
 # include <string.h>
+# include "ft_reader.h"
 # include "get_next_line.h"
 # include "ft_printf/ft_printf.h"
 
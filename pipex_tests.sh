@@ -41,14 +41,119 @@ echo "[TEST 7] tr + wc -w"
 < infile tr a-z A-Z | wc -w > expected.txt
 diff outfile expected.txt && echo "✅ OK" || echo "❌ Error"
 
+# Test 8: Argumentos con comillas, sin sh -c
+echo "[TEST 8] Comillas: awk + grep"
+./pipex infile "awk '{print \$1, \"-\", NR}'" "grep \"l -\"" outfile
+< infile awk '{print $1, "-", NR}' | grep "l -" > expected.txt
+diff outfile expected.txt && echo "✅ OK" || echo "❌ Error"
+
+# Test 9: grep builtin con un NUL al final, igual que el grep del sistema
+echo "[TEST 9] grep con entrada binaria"
+{ yes "$(printf '%2000s' | tr ' ' x)" | head -n 500; printf 'a\0b ERROR\n'; } > binfile
+ok=1
+for cmd in "grep ERROR" "grep -v foo" "grep -E ^x+" "grep -c x" "grep -m 3 x"; do
+	./pipex binfile "$cmd" "wc -c" outfile 2> stderr.txt
+	./pipex --no-builtins binfile "$cmd" "wc -c" expected.txt 2> expected_err.txt
+	diff outfile expected.txt && diff stderr.txt expected_err.txt || ok=0
+done
+# Desde un pipe, solo lo que no depende de cómo llegan los datos
+for cmd in "grep ERROR" "grep -c x"; do
+	< binfile cat | ./pipex /dev/stdin "$cmd" "wc -c" outfile 2> stderr.txt
+	< binfile grep ${cmd#grep } 2> expected_err.txt | wc -c > expected.txt
+	diff outfile expected.txt && diff stderr.txt expected_err.txt || ok=0
+done
+[ $ok = 1 ] && echo "✅ OK" || echo "❌ Error"
+rm -f binfile stderr.txt expected_err.txt
+
+# Test 10: builtins contra los binarios del sistema, con texto y binario
+echo "[TEST 10] builtins contra --no-builtins"
+seq 1 20000 | gzip -n > binfile
+ok=1
+for file in infile binfile; do
+	for cmd in "cat" "wc" "wc -l" "wc -c" "head -n 3" "head -c 100" "tail -n 2" \
+		"tail -c 7" "tr a-z A-Z" "tr -d e" "tr -s l" "grep e" "grep -v e" \
+		"grep -c e" "grep -E e|o" "grep -i KEN" "grep -m 1 -F e"; do
+		./pipex "$file" "$cmd" "cat" outfile 2> stderr.txt
+		status=$?
+		./pipex --no-builtins "$file" "$cmd" "cat" expected.txt 2> expected_err.txt
+		if [ $status != $? ] || ! cmp -s outfile expected.txt \
+			|| ! cmp -s stderr.txt expected_err.txt; then
+			echo "$file: $cmd"
+			ok=0
+		fi
+	done
+done
+[ $ok = 1 ] && echo "✅ OK" || echo "❌ Error"
+rm -f stderr.txt expected_err.txt
+
+# Test 11: --optimize quita y fusiona etapas sin cambiar la salida
+echo "[TEST 11] --optimize"
+ok=1
+./pipex --optimize infile "cat" "tr a-z A-Z" "head -n 3" "cat" outfile
+< infile tr a-z A-Z | head -n 3 > expected.txt
+diff outfile expected.txt || ok=0
+# La salida optimizada tiene que ser idéntica byte a byte a la normal
+for cmds in "cat|wc" "cat|cat|wc -l" "cat|tr a-z A-Z|wc" "grep e|cat|wc" \
+	"cat|head -n 2|cat" "sort -r|head -n 2" "cat|sort|head -n 1"; do
+	IFS='|' read -ra args <<< "$cmds"
+	./pipex --optimize infile "${args[@]}" outfile
+	./pipex infile "${args[@]}" expected.txt
+	cmp -s outfile expected.txt || { echo "$cmds"; ok=0; }
+done
+[ $ok = 1 ] && echo "✅ OK" || echo "❌ Error"
+
+# Test 12: una tubería que solo copia la hace el padre, también con huecos
+echo "[TEST 12] Copia directa"
+truncate -s 1M sparse
+cat binfile >> sparse
+./pipex --optimize sparse "cat" "cat" outfile
+cmp outfile sparse && ./pipex --optimize binfile "cat" "cat" outfile \
+	&& cmp outfile binfile && echo "✅ OK" || echo "❌ Error"
+rm -f sparse
+
+# Test 13: --batch escribe un resultado por línea, sin errores mezclados
+echo "[TEST 13] --batch"
+printf '%s\n' 'infile cat "wc -l" out1' '# comentario' \
+	'infile noexist noexist out2' 'binfile "grep -c 1" cat out3' > manifest
+./pipex --batch=manifest --jobs=2 2> /dev/null | cut -f 1,2 > outfile
+printf '1\t0\n3\t127\n4\t0\n' > expected.txt
+diff outfile expected.txt && < infile wc -l | diff out1 - \
+	&& < binfile grep -c 1 | diff out3 - && echo "✅ OK" || echo "❌ Error"
+rm -f manifest out1 out2 out3
+
+# Test 14: --split corta la entrada y junta las salidas en orden
+echo "[TEST 14] --split"
+seq 1 300000 > bigfile
+./pipex --split=4 bigfile "grep 7" "tr 1 X" outfile
+< bigfile grep 7 | tr 1 X > expected.txt
+diff outfile expected.txt \
+	&& [ "$(./pipex --split=4 bigfile "grep 7" noexist outfile 2>&1 \
+	| grep -c 'not found')" = 1 ] && echo "✅ OK" || echo "❌ Error"
+rm -f bigfile binfile
+
+# Test 15: con --pipe-size=auto, head al final sigue cortando a los anteriores
+echo "[TEST 15] --pipe-size=auto con head -n1"
+timeout 10 ./pipex --pipe-size=auto /dev/zero "cat" "tr '\\0' '\\n'" \
+	"cat" "head -n1" outfile
+[ $? = 0 ] && echo | cmp -s outfile - \
+	&& (ulimit -n 16; ./pipex --pipe-size=auto infile \
+	$(printf 'cat %.0s' $(seq 1000)) outfile 2> /dev/null) \
+	&& cmp -s outfile infile && echo "✅ OK" || echo "❌ Error"
+
 # Bonus 1: Varios pipes (si implementado)
 echo "[BONUS 1] Múltiples pipes"
 ./pipex infile "grep e" "tr a-z A-Z" "sort" "uniq" outfile
 < infile grep e | tr a-z A-Z | sort | uniq > expected.txt
 diff outfile expected.txt && echo "✅ OK" || echo "❌ Error"
 
-# Bonus 2: here_doc (requiere entrada manual)
-echo "[BONUS 2] here_doc"
+# Bonus 2: Pipeline largo con límite de descriptores bajo
+echo "[BONUS 2] 1000 pipes con ulimit -n 16"
+(ulimit -n 16; ./pipex infile $(printf 'cat %.0s' $(seq 1000)) outfile)
+< infile cat > expected.txt
+diff outfile expected.txt && echo "✅ OK" || echo "❌ Error"
+
+# Bonus 3: here_doc (requiere entrada manual)
+echo "[BONUS 3] here_doc"
 echo "Escribe 2 líneas y luego END para terminar"
 ./pipex here_doc END "cat" "wc -l" outfile
 
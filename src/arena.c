@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:24:00 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/17 23:24:00 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Starts a new block large enough for size bytes.
+ *
+ * @param arena The arena.
+ * @param size Bytes the caller needs.
+ * @return 0 on success, -1 on allocation failure.
+ */
+static int	block_new(t_arena *arena, size_t size)
+{
+	t_ablock	*block;
+	size_t		cap;
+
+	cap = ARENA_BLOCK;
+	if (size > cap)
+		cap = size;
+	block = malloc(sizeof(t_ablock) + cap);
+	if (!block)
+		return (-1);
+	block->next = arena->head;
+	block->cap = cap;
+	block->used = 0;
+	arena->head = block;
+	arena->blocks++;
+	return (0);
+}
+
+void	*arena_alloc(t_arena *arena, size_t size)
+{
+	void	*ptr;
+
+	size = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+	if ((!arena->head || arena->head->cap - arena->head->used < size)
+		&& block_new(arena, size) < 0)
+		return (NULL);
+	ptr = (char *)(arena->head + 1) + arena->head->used;
+	arena->head->used += size;
+	arena->allocs++;
+	arena->bytes += size;
+	return (ptr);
+}
+
+char	*arena_strdup(t_arena *arena, const char *str)
+{
+	char	*dup;
+	size_t	len;
+
+	len = ft_strlen(str);
+	dup = arena_alloc(arena, len + 1);
+	if (dup)
+		ft_memcpy(dup, str, len + 1);
+	return (dup);
+}
+
+void	arena_shrink(t_arena *arena, void *ptr, void *end)
+{
+	size_t	used;
+
+	if (!arena->head || (char *)ptr < (char *)(arena->head + 1)
+		|| (char *)end < (char *)ptr)
+		return ;
+	used = (char *)end - (char *)(arena->head + 1);
+	used = (used + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+	if (used > arena->head->used)
+		return ;
+	arena->bytes -= arena->head->used - used;
+	arena->head->used = used;
+}
+
+void	arena_reset(t_arena *arena)
+{
+	t_ablock	*next;
+
+	if (ARENA_DEBUG && arena->allocs)
+		arena_report(arena);
+	while (arena->head)
+	{
+		next = arena->head->next;
+		free(arena->head);
+		arena->head = next;
+	}
+	ft_bzero(arena, sizeof(*arena));
+}
@@ -0,0 +1,25 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena_debug.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:24:00 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/17 23:24:00 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+void	arena_report(t_arena *arena)
+{
+	char	line[128];
+	int		len;
+
+	len = snprintf(line, sizeof(line),
+			"pipex[%d]: arena: %zu allocs, %zu bytes, %zu heap blocks\n",
+			getpid(), arena->allocs, arena->bytes, arena->blocks);
+	if (len > 0 && len < (int) sizeof(line))
+		write(STDERR_FILENO, line, len);
+}
@@ -0,0 +1,152 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   batch.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:06:57 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:06:57 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Makes room for one more job, doubling the job list when full.
+ *
+ * @param b The pool.
+ * @return 0 on success, -1 on allocation failure.
+ */
+static int	batch_grow(t_batch *b)
+{
+	t_job	*jobs;
+	int		cap;
+
+	if (b->count < b->cap)
+		return (0);
+	cap = b->cap * 2;
+	if (!cap)
+		cap = BATCH_JOBS;
+	jobs = malloc(sizeof(t_job) * cap);
+	if (!jobs)
+		return (-1);
+	if (b->count)
+		ft_memcpy(jobs, b->jobs, sizeof(t_job) * b->count);
+	free(b->jobs);
+	b->jobs = jobs;
+	b->cap = cap;
+	return (0);
+}
+
+/**
+ * @brief Checks that a manifest line is a pipeline pipex can run.
+ *
+ * here_doc is refused: every worker would read the same stdin.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param job The job made from the line.
+ * @param err 1 if the line has an unterminated quote.
+ * @return -1 if it can run, 1 after reporting why not.
+ */
+static int	batch_check(t_pipex *pipex, t_job *job, int err)
+{
+	const char	*why;
+
+	if (err)
+		why = "unterminated quote";
+	else if (job->ac < 5)
+		why = "needs an infile, two commands and an outfile";
+	else if (!ft_strncmp(job->av[1], "here_doc", 9))
+		why = "here_doc is not supported in a batch";
+	else
+		return (-1);
+	dprintf(STDERR_FILENO, "pipex: %s:%d: %s\n", pipex->opts.batch,
+		job->line, why);
+	return (1);
+}
+
+/**
+ * @brief Adds a manifest line to the job list as a pipex command line.
+ *
+ * A pipeline of n commands counts n + 1 processes, its worker
+ * included, and 2n descriptors: the infile, the outfile and both ends
+ * of each pipe.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param b The pool, with room for one more job.
+ * @param line The line.
+ * @param n Its line number.
+ * @return 0 on success, -1 on allocation failure.
+ */
+static int	batch_parse(t_pipex *pipex, t_batch *b, char *line, int n)
+{
+	t_job	*job;
+	char	**tok;
+	int		err;
+	int		len;
+
+	job = &b->jobs[b->count];
+	ft_bzero(job, sizeof(*job));
+	job->line = n;
+	tok = tokenize_cmd(&pipex->arena, line, &err);
+	len = 0;
+	while (tok && tok[len])
+		len++;
+	job->av = arena_alloc(&pipex->arena, sizeof(char *) * (len + 2));
+	if (!tok || !job->av)
+		return (-1);
+	job->av[0] = "pipex";
+	ft_memcpy(job->av + 1, tok, sizeof(char *) * (len + 1));
+	job->ac = len + 1;
+	job->procs = len - 1;
+	job->fds = 2 * (len - 2);
+	job->status = batch_check(pipex, job, err);
+	b->count++;
+	return (0);
+}
+
+int	batch_read(t_pipex *pipex, t_batch *b)
+{
+	char	*line;
+	int		fd;
+	int		n;
+	int		i;
+	int		err;
+
+	fd = open(pipex->opts.batch, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return (-1);
+	err = 0;
+	n = 0;
+	line = get_next_line(fd);
+	while (line && !err)
+	{
+		n++;
+		i = strspn(line, " \t");
+		if (line[i] && line[i] != '\n' && line[i] != '#')
+			err = batch_grow(b) < 0 || batch_parse(pipex, b, line, n) < 0;
+		free(line);
+		line = get_next_line(fd);
+	}
+	free(line);
+	close(fd);
+	return (-err);
+}
+
+void	batch_done(t_pipex *pipex, t_batch *b, t_job *job)
+{
+	t_job	*next;
+
+	b->failed |= (job->status != 0);
+	if (pipex->opts.batch_order == BATCH_COMPLETION)
+		dprintf(STDOUT_FILENO, BATCH_RESULT, job->line, job->status,
+			job->ms);
+	while (pipex->opts.batch_order == BATCH_MANIFEST
+		&& b->printed < b->count && b->jobs[b->printed].status >= 0)
+	{
+		next = &b->jobs[b->printed++];
+		dprintf(STDOUT_FILENO, BATCH_RESULT, next->line, next->status,
+			next->ms);
+	}
+}
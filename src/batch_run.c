@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   batch_run.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:07:19 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:40:24 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Checks whether a job may start now.
+ *
+ * A job bigger than --max-procs or --max-fds on its own still runs,
+ * alone, so that no line is left waiting forever.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param b The pool.
+ * @param job The next job.
+ * @return 1 if it may start, 0 if it must wait for a running one.
+ */
+static int	batch_admit(t_pipex *pipex, t_batch *b, t_job *job)
+{
+	if (b->running == 0)
+		return (1);
+	if (b->running >= pipex->opts.jobs)
+		return (0);
+	if (pipex->opts.max_procs
+		&& b->procs + job->procs > pipex->opts.max_procs)
+		return (0);
+	return (!pipex->opts.max_fds
+		|| b->fds + job->fds <= pipex->opts.max_fds);
+}
+
+/**
+ * @brief Forks the worker of a job, which runs its line as pipex would
+ * with the options, PATH list and PATH index of the parent.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param b The pool.
+ * @param job The job.
+ * @param envp Environment variables.
+ */
+static void	batch_launch(t_pipex *pipex, t_batch *b, t_job *job, char **envp)
+{
+	clock_gettime(CLOCK_MONOTONIC, &job->start);
+	job->pid = fork();
+	if (job->pid == 0)
+		exit(run_pipeline(pipex, job->ac, job->av, envp));
+	if (job->pid < 0)
+	{
+		handle_error("fork");
+		job->status = 1;
+		batch_done(pipex, b, job);
+		return ;
+	}
+	b->live[b->running++] = job - b->jobs;
+	b->procs += job->procs;
+	b->fds += job->fds;
+}
+
+/**
+ * @brief Takes the job of a worker that ended off the running list.
+ *
+ * @param b The pool.
+ * @param pid The worker.
+ * @return Its job, or NULL for a process that is not a worker.
+ */
+static t_job	*batch_job(t_batch *b, pid_t pid)
+{
+	t_job	*job;
+	int		i;
+
+	i = 0;
+	while (i < b->running && b->jobs[b->live[i]].pid != pid)
+		i++;
+	if (i == b->running)
+		return (NULL);
+	job = b->jobs + b->live[i];
+	b->live[i] = b->live[--b->running];
+	b->procs -= job->procs;
+	b->fds -= job->fds;
+	return (job);
+}
+
+/**
+ * @brief Waits for a worker to end and records its job's status, 128
+ * plus the signal number if it was killed.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param b The pool.
+ */
+static void	batch_reap(t_pipex *pipex, t_batch *b)
+{
+	struct timespec	now;
+	t_job			*job;
+	pid_t			pid;
+	int				status;
+
+	pid = waitpid(-1, &status, 0);
+	if (pid < 0 && errno == ECHILD)
+		b->running = 0;
+	if (pid <= 0)
+		return ;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	job = batch_job(b, pid);
+	if (!job)
+		return ;
+	job->status = WEXITSTATUS(status);
+	if (WIFSIGNALED(status))
+		job->status = 128 + WTERMSIG(status);
+	job->ms = elapsed_ms(&job->start, &now);
+	batch_done(pipex, b, job);
+}
+
+int	run_batch(t_pipex *pipex, char **envp)
+{
+	t_batch	b;
+
+	ft_bzero(&b, sizeof(b));
+	b.live = malloc(sizeof(int) * pipex->opts.jobs);
+	if (!b.live || batch_read(pipex, &b) < 0)
+	{
+		handle_error(pipex->opts.batch);
+		b.failed = 1;
+		b.count = 0;
+	}
+	load_paths(pipex, envp);
+	while (b.next < b.count || b.running > 0)
+	{
+		if (b.next < b.count && b.jobs[b.next].status >= 0)
+			batch_done(pipex, &b, &b.jobs[b.next++]);
+		else if (b.next < b.count && batch_admit(pipex, &b, &b.jobs[b.next]))
+			batch_launch(pipex, &b, &b.jobs[b.next++], envp);
+		else
+			batch_reap(pipex, &b);
+	}
+	free(b.live);
+	free(b.jobs);
+	free_parsed(pipex);
+	pidx_free(pipex);
+	return (b.failed);
+}
@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:27:45 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:36:53 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Returns the builtin registry, terminated by a NULL name.
+ *
+ * The fused stage entry, at BI_FUSE, has an empty name so that no
+ * command matches it; only builtin_stage picks it.
+ *
+ * @return The registry.
+ */
+static const t_builtin	*builtin_table(void)
+{
+	static const t_builtin	table[] = {
+	{"cat", bi_cat_parse, bi_cat},
+	{"wc", bi_wc_parse, bi_wc},
+	{"head", bi_count_parse, bi_head},
+	{"tail", bi_count_parse, bi_tail},
+	{"tr", bi_tr_parse, bi_tr},
+	{"grep", bi_grep_parse, bi_grep},
+	{"", bi_fuse_parse, bi_fuse},
+	{NULL, NULL, NULL}
+	};
+
+	return (table);
+}
+
+int	builtin_find(char **argv)
+{
+	const t_builtin	*table;
+	t_bargs			args;
+	int				i;
+
+	table = builtin_table();
+	i = 0;
+	while (argv[0] && table[i].name)
+	{
+		if (!ft_strncmp(table[i].name, argv[0], ft_strlen(table[i].name) + 1))
+		{
+			if (table[i].parse(argv, &args))
+				return (-1);
+			return (i);
+		}
+		i++;
+	}
+	return (-1);
+}
+
+int	builtin_stage(t_pipex *pipex, int i)
+{
+	if (pipex->cmd_fused && pipex->cmd_fused[i] > 1)
+		return (BI_FUSE);
+	return (builtin_find(pipex->cmd_args[i]));
+}
+
+int	fuse_element(char **argv, t_bargs *args)
+{
+	args->kind = -1;
+	if (!argv[0])
+		return (1);
+	if (!ft_strncmp(argv[0], "cat", 4) && !argv[1])
+		args->kind = FUSE_CAT;
+	else if (!ft_strncmp(argv[0], "head", 5) && !bi_count_parse(argv, args))
+		args->kind = FUSE_HEAD;
+	else if (!ft_strncmp(argv[0], "tr", 3) && !bi_tr_parse(argv, args))
+		args->kind = FUSE_TR;
+	else if (!ft_strncmp(argv[0], "sort", 5) && !bi_sort_parse(argv, args))
+		args->kind = FUSE_SORT;
+	return (args->kind < 0);
+}
+
+void	run_builtin(t_pipex *pipex)
+{
+	static char		path[PATH_MAX];
+	const t_builtin	*builtin;
+	t_bargs			args;
+	char			*cmd;
+	int				ret;
+
+	if (!pipex->cmd_builtin || pipex->cmd_builtin[pipex->idx] < 0)
+		return ;
+	builtin = &builtin_table()[pipex->cmd_builtin[pipex->idx]];
+	cmd = pipex->cmd_args[pipex->idx][0];
+	builtin->parse(pipex->cmd_args[pipex->idx], &args);
+	close_range(3, ~0U, 0);
+	ret = builtin->run(&args);
+	if (ret != BI_EXEC)
+		exit(ret);
+	pipex->cmd_builtin[pipex->idx] = -1;
+	pipex->cmd_paths[pipex->idx] = NULL;
+	if (pipex->paths)
+		pipex->cmd_paths[pipex->idx] = find_command_path(pipex->paths,
+				cmd, path);
+	errno = ENOENT;
+	if (!pipex->cmd_paths[pipex->idx])
+		exit(bi_fail(cmd, NULL) + 126);
+}
@@ -0,0 +1,87 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_cat.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:27:45 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/17 23:27:45 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+int	bi_cat_parse(char **argv, t_bargs *args)
+{
+	int	i;
+
+	i = 1;
+	while (argv[i])
+	{
+		if (argv[i][0] == '-' && argv[i][1])
+			return (1);
+		i++;
+	}
+	args->files = argv + 1;
+	return (0);
+}
+
+/**
+ * @brief Copies one input to stdout.
+ *
+ * @param fd The input descriptor.
+ * @param name Input name for error messages.
+ * @return 0 on success, 1 on a read or write error.
+ */
+static int	cat_fd(int fd, const char *name)
+{
+	char	buf[BI_BUF];
+	ssize_t	bytes;
+
+	bytes = bi_read(fd, buf, sizeof(buf));
+	while (bytes > 0)
+	{
+		if (bi_write(buf, bytes) < 0)
+			return (bi_fail("cat", "write error"));
+		bytes = bi_read(fd, buf, sizeof(buf));
+	}
+	if (bytes < 0)
+		return (bi_fail("cat", name));
+	return (0);
+}
+
+/**
+ * @brief Copies a named input to stdout; "-" is stdin.
+ *
+ * @param file The input name.
+ * @return 0 on success, 1 on error.
+ */
+static int	cat_file(const char *file)
+{
+	int	status;
+	int	fd;
+
+	if (!ft_strncmp(file, "-", 2))
+		return (cat_fd(STDIN_FILENO, "-"));
+	fd = open(file, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return (bi_fail("cat", file));
+	status = cat_fd(fd, file);
+	close(fd);
+	return (status);
+}
+
+int	bi_cat(t_bargs *args)
+{
+	int	status;
+	int	i;
+
+	if (!args->files[0])
+		return (cat_fd(STDIN_FILENO, "-"));
+	status = 0;
+	i = 0;
+	while (args->files[i])
+		status |= cat_file(args->files[i++]);
+	return (status);
+}
@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_fuse.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:38:33 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 00:38:33 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+int	bi_fuse_parse(char **argv, t_bargs *args)
+{
+	t_bargs	sub;
+	int		n;
+
+	args->files = argv;
+	n = 0;
+	while (*argv)
+	{
+		if (fuse_element(argv, &sub))
+			return (1);
+		while (*argv)
+			argv++;
+		argv++;
+		n++;
+	}
+	args->count = n;
+	return (n < 2);
+}
+
+/**
+ * @brief Passes one block through every command of the chain.
+ *
+ * @param sub The commands.
+ * @param n Number of commands.
+ * @param buf The block, rewritten in place.
+ * @param len Length of buf.
+ * @return The length left for stdout.
+ */
+static size_t	fuse_block(t_bargs *sub, int n, unsigned char *buf,
+	size_t len)
+{
+	int	k;
+
+	k = -1;
+	while (++k < n && len)
+	{
+		if (sub[k].kind == FUSE_TR)
+			len = tr_block(&sub[k], tr_kernel(), buf, len);
+		else if (sub[k].kind == FUSE_HEAD)
+			len = head_take(&sub[k], (char *)buf, len);
+	}
+	return (len);
+}
+
+/**
+ * @brief Reads stdin block by block through a chain of filters.
+ *
+ * Stops once a head has nothing left to print, like head itself.
+ *
+ * @param sub The commands.
+ * @param n Number of commands.
+ * @param name Command name for error messages.
+ * @return The exit status.
+ */
+static int	fuse_loop(t_bargs *sub, int n, const char *name)
+{
+	unsigned char	buf[BI_BUF];
+	ssize_t			bytes;
+	size_t			len;
+	int				k;
+
+	bytes = 1;
+	while (bytes > 0)
+	{
+		k = 0;
+		while (k < n && (sub[k].kind != FUSE_HEAD || sub[k].count > 0))
+			k++;
+		if (k < n)
+			break ;
+		bytes = bi_read(STDIN_FILENO, (char *)buf, sizeof(buf));
+		if (bytes <= 0)
+			break ;
+		len = fuse_block(sub, n, buf, bytes);
+		if (bi_write((char *)buf, len) < 0)
+			return (bi_fail(name, "write error"));
+	}
+	if (bytes < 0)
+		return (bi_fail(name, "read error"));
+	return (0);
+}
+
+int	bi_fuse(t_bargs *args)
+{
+	t_bargs	*sub;
+	char	**argv;
+	int		status;
+	int		k;
+
+	sub = malloc(sizeof(t_bargs) * args->count);
+	if (!sub)
+		return (bi_fail(args->files[0], NULL));
+	argv = args->files;
+	k = -1;
+	while (++k < args->count)
+	{
+		fuse_element(argv, &sub[k]);
+		if (sub[k].kind == FUSE_TR)
+			tr_plan(&sub[k]);
+		while (*argv)
+			argv++;
+		argv++;
+	}
+	if (sub[0].kind == FUSE_SORT)
+		status = bi_topk(&sub[0], sub[1].count);
+	else
+		status = fuse_loop(sub, args->count, args->files[0]);
+	free(sub);
+	return (status);
+}
+
+int	bi_tr(t_bargs *args)
+{
+	tr_plan(args);
+	args->kind = FUSE_TR;
+	return (fuse_loop(args, 1, "tr"));
+}
@@ -0,0 +1,158 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_grep.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:48:20 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 00:24:43 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Parses one option argument, which may bundle several flags.
+ *
+ * -e, -f and -m take the rest of the argument or the next one.
+ *
+ * @param argv The stage's argv.
+ * @param i Index of the option; advanced past what it consumed.
+ * @param args Receives the option.
+ * @return 0 on success, 1 for usage left to the real grep.
+ */
+static int	grep_opt(char **argv, int *i, t_bargs *args)
+{
+	char		*flags;
+	const char	*opt;
+	const char	*val;
+
+	flags = "vciFGE";
+	opt = argv[(*i)++];
+	while (*++opt && ft_strchr(flags, *opt))
+		args->mode |= 1 << (ft_strchr(flags, *opt) - flags);
+	if (!*opt)
+		return (0);
+	val = opt + 1;
+	if (!*val)
+		val = argv[(*i)++];
+	if (!val || !ft_strchr("efm", *opt))
+		return (1);
+	if (*opt == 'e' && args->npats < GREP_PATS)
+		args->pats[args->npats++] = val;
+	else if (*opt == 'f' && !args->pat_file)
+		args->pat_file = val;
+	else if (*opt != 'm' || bi_number(val, &args->count))
+		return (1);
+	return (0);
+}
+
+/**
+ * @brief Checks whether patterns need the regex engine.
+ *
+ * @param args Parsed arguments; gets GREP_REGEX for any operator.
+ * @param text Patterns, one per line.
+ * @param len Length of text.
+ * @return 0 if they can be used, 1 for invalid UTF-8 outside the C
+ * locale.
+ */
+static int	grep_text_ok(t_bargs *args, const char *text, size_t len)
+{
+	char		*meta;
+	size_t		i;
+
+	meta = "\\.[*^$";
+	if (args->mode & GREP_EXT)
+		meta = "\\.[*^$+?{}()|";
+	i = 0;
+	while (!(args->mode & GREP_FIXED) && i < len)
+	{
+		if (text[i] && ft_strchr(meta, text[i]))
+			args->mode |= GREP_REGEX;
+		i++;
+	}
+	return (!bi_c_locale() && !bi_utf8_valid(text, len));
+}
+
+/**
+ * @brief Compiles the patterns once to check that the regex engine
+ * supports them.
+ *
+ * @param args Parsed arguments.
+ * @param data Contents of the -f file, or NULL.
+ * @param len Length of data.
+ * @return 0 if it does, 1 to run the real grep.
+ */
+static int	grep_rx_check(const t_bargs *args, const char *data, size_t len)
+{
+	static t_grepdfa	d;
+	int					i;
+
+	grep_rx_init(&d, args->mode, !bi_c_locale());
+	i = -1;
+	while (++i < args->npats)
+		if (grep_rx_parse(&d, args->pats[i], ft_strlen(args->pats[i])) < 0)
+			return (1);
+	if (data && len
+		&& grep_rx_parse(&d, data, len - (data[len - 1] == '\n')) < 0)
+		return (1);
+	return (0);
+}
+
+/**
+ * @brief Checks the locale, the matcher and every pattern.
+ *
+ * @param args Parsed arguments.
+ * @return 0 if the builtin can run them, 1 otherwise.
+ */
+static int	grep_check(t_bargs *args)
+{
+	char	*data;
+	size_t	len;
+	int		i;
+	int		bad;
+
+	if (!!(args->mode & GREP_FIXED) + !!(args->mode & GREP_BASIC)
+		+ !!(args->mode & GREP_EXT) > 1 || (!bi_c_locale()
+			&& ((args->mode & GREP_ICASE) || !bi_utf8_locale()))
+		|| (args->pat_file && !ft_strncmp(args->pat_file, "-", 2)))
+		return (1);
+	data = NULL;
+	len = 0;
+	if (args->pat_file)
+		data = grep_load(args->pat_file, &len);
+	if (args->pat_file && !data)
+		return (1);
+	bad = (data && grep_text_ok(args, data, len));
+	i = -1;
+	while (!bad && ++i < args->npats)
+		bad = grep_text_ok(args, args->pats[i], ft_strlen(args->pats[i]));
+	if (!bad && (args->mode & GREP_REGEX))
+		bad = grep_rx_check(args, data, len);
+	free(data);
+	return (bad);
+}
+
+int	bi_grep_parse(char **argv, t_bargs *args)
+{
+	int	i;
+
+	args->mode = 0;
+	args->count = -1;
+	args->npats = 0;
+	args->pat_file = NULL;
+	i = 1;
+	while (argv[i] && argv[i][0] == '-' && argv[i][1])
+		if (grep_opt(argv, &i, args))
+			return (1);
+	if (!args->npats && !args->pat_file)
+	{
+		if (!argv[i])
+			return (1);
+		args->pats[args->npats++] = argv[i++];
+	}
+	if (argv[i])
+		return (1);
+	return (grep_check(args));
+}
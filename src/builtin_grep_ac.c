@@ -0,0 +1,165 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_grep_ac.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:48:20 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/17 23:54:18 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Gives every byte used by a pattern its own class.
+ *
+ * With -i the upper-case letters share the class of their (folded)
+ * lower-case pattern letters.
+ *
+ * @param g The grep state.
+ */
+static void	ac_classes(t_grep *g)
+{
+	t_grepac	*ac;
+	size_t		i;
+
+	ac = &g->ac;
+	ft_bzero(ac->cls, sizeof(ac->cls));
+	ac->ncls = 1;
+	i = 0;
+	while (i < g->len)
+	{
+		if (g->text[i] != '\n' && !ac->cls[g->text[i]])
+			ac->cls[g->text[i]] = ac->ncls++;
+		i++;
+	}
+	i = 'A';
+	while ((g->flags & GREP_ICASE) && i <= 'Z')
+	{
+		ac->cls[i] = ac->cls[i + ('a' - 'A')];
+		i++;
+	}
+	ac->nstates = g->len - g->npats + 1;
+}
+
+/**
+ * @brief Inserts every pattern into the trie.
+ *
+ * @param g The grep state; ac.next is filled with -1.
+ * @param out Receives 1 for the states that end a pattern.
+ */
+static void	ac_trie(t_grep *g, unsigned char *out)
+{
+	t_grepac	*ac;
+	size_t		i;
+	int32_t		state;
+	int32_t		used;
+
+	ac = &g->ac;
+	used = 1;
+	state = 0;
+	i = 0;
+	while (i < g->len)
+	{
+		if (g->text[i] == '\n')
+		{
+			out[state] = 1;
+			state = 0;
+		}
+		else if (ac->next[state * ac->ncls + ac->cls[g->text[i]]] < 0)
+		{
+			ac->next[state * ac->ncls + ac->cls[g->text[i]]] = used;
+			state = used++;
+		}
+		else
+			state = ac->next[state * ac->ncls + ac->cls[g->text[i]]];
+		i++;
+	}
+}
+
+/**
+ * @brief Turns the trie into a DFA, breadth first along failure links.
+ *
+ * @param ac The automaton.
+ * @param out Match flags, extended along failure links.
+ * @param fail Scratch: failure link of each state.
+ * @param queue Scratch: BFS queue.
+ */
+static void	ac_link(t_grepac *ac, unsigned char *out, int32_t *fail,
+	int32_t *queue)
+{
+	size_t	head;
+	size_t	tail;
+	int32_t	s;
+	int32_t	*t;
+	int		c;
+
+	head = 0;
+	tail = 1;
+	while (head < tail)
+	{
+		s = queue[head++];
+		out[s] |= out[fail[s]];
+		c = -1;
+		while (++c < ac->ncls)
+		{
+			t = &ac->next[s * ac->ncls + c];
+			if (*t < 0)
+				*t = ac->next[fail[s] * ac->ncls + c] * (s != 0);
+			else
+			{
+				fail[*t] = ac->next[fail[s] * ac->ncls + c] * (s != 0);
+				queue[tail++] = *t;
+			}
+		}
+	}
+}
+
+/**
+ * @brief Premultiplies the transitions and marks those that end a match.
+ *
+ * @param ac The automaton.
+ * @param out Match flags of each state.
+ */
+static void	ac_final(t_grepac *ac, const unsigned char *out)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < ac->nstates * ac->ncls)
+	{
+		if (out[ac->next[i]])
+			ac->next[i] = -1;
+		else
+			ac->next[i] *= ac->ncls;
+		i++;
+	}
+}
+
+int	grep_ac_build(t_grep *g)
+{
+	t_grepac		*ac;
+	unsigned char	*scratch;
+	unsigned char	*out;
+
+	ac = &g->ac;
+	ac_classes(g);
+	if (ac->nstates * ac->ncls > GREP_STATES)
+		return (-1);
+	ac->next = malloc(ac->nstates * ac->ncls * sizeof(int32_t));
+	scratch = ft_calloc(ac->nstates, 1 + 2 * sizeof(int32_t));
+	if (!ac->next || !scratch)
+	{
+		free(scratch);
+		return (-1);
+	}
+	memset(ac->next, 0xff, ac->nstates * ac->ncls * sizeof(int32_t));
+	out = scratch + 2 * ac->nstates * sizeof(int32_t);
+	ac_trie(g, out);
+	ac_link(ac, out, (int32_t *)scratch, (int32_t *)scratch + ac->nstates);
+	ac_final(ac, out);
+	free(scratch);
+	return (0);
+}
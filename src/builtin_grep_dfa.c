@@ -0,0 +1,168 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_grep_dfa.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:04:19 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 00:24:43 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+int	grep_dfa_close(const t_grepdfa *d, uint64_t *set, int bol, int eol)
+{
+	int	changed;
+	int	p;
+	int	w;
+
+	changed = 1;
+	while (changed)
+	{
+		changed = 0;
+		p = -1;
+		while (++p < d->npos)
+		{
+			if (!(set[p / 64] >> (p % 64) & 1) || !((d->kind[p] == RX_BOL
+						&& bol) || (d->kind[p] == RX_EOL && eol)))
+				continue ;
+			w = -1;
+			while (++w < GREP_WORDS)
+			{
+				changed |= (d->follow[p][w] & ~set[w]) != 0;
+				set[w] |= d->follow[p][w];
+			}
+		}
+	}
+	p = d->npos - 1;
+	return (set[p / 64] >> (p % 64) & 1);
+}
+
+/**
+ * @brief Computes the positions waiting after a byte of class c.
+ *
+ * The first positions of the patterns are always added back, since a
+ * match may start anywhere in the line.
+ *
+ * @param d The automaton.
+ * @param from Positions of the current state.
+ * @param c The byte class, not the newline.
+ * @param set Receives the positions.
+ * @return 1 if they include the final position, 0 otherwise.
+ */
+static int	dfa_move(const t_grepdfa *d, const uint64_t *from, int c,
+	uint64_t *set)
+{
+	int	b;
+	int	p;
+	int	w;
+
+	b = d->rep[c];
+	memcpy(set, d->whole.first, sizeof(d->whole.first));
+	p = -1;
+	while (++p < d->npos)
+	{
+		if (!(from[p / 64] >> (p % 64) & 1)
+			|| !(d->set[p][b / 64] >> (b % 64) & 1))
+			continue ;
+		w = -1;
+		while (++w < GREP_WORDS)
+			set[w] |= d->follow[p][w];
+	}
+	p = d->npos - 1;
+	return (set[p / 64] >> (p % 64) & 1);
+}
+
+/**
+ * @brief Finds or adds the state of a position set.
+ *
+ * A full cache is emptied first, keeping only the start state.
+ *
+ * @param d The automaton.
+ * @param set The positions.
+ * @return The state's offset in next.
+ */
+static int32_t	dfa_state(t_grepdfa *d, const uint64_t *set)
+{
+	uint64_t	h;
+	size_t		i;
+
+	h = 0;
+	i = 0;
+	while (i < GREP_WORDS)
+		h = (h ^ set[i++]) * 0x9e3779b97f4a7c15ULL;
+	i = (h >> 32) & (GREP_DFA * 2 - 1);
+	while (d->slots[i] >= 0 && memcmp(d->sets + d->slots[i] * GREP_WORDS,
+			set, GREP_WORDS * sizeof(uint64_t)))
+		i = (i + 1) & (GREP_DFA * 2 - 1);
+	if (d->slots[i] >= 0)
+		return (d->slots[i] * d->ncls);
+	if (d->nstates == GREP_DFA)
+	{
+		memset(d->next, 0xff, GREP_DFA * d->ncls * sizeof(int32_t));
+		memset(d->slots, 0xff, GREP_DFA * 2 * sizeof(int32_t));
+		d->nstates = 1;
+		d->flushes++;
+		return (dfa_state(d, set));
+	}
+	d->slots[i] = d->nstates;
+	memcpy(d->sets + d->nstates * GREP_WORDS, set,
+		GREP_WORDS * sizeof(uint64_t));
+	return (d->nstates++ * d->ncls);
+}
+
+int32_t	grep_dfa_step(t_grepdfa *d, int32_t s, int c)
+{
+	uint64_t	set[GREP_WORDS];
+	uint64_t	*from;
+	int			flushes;
+	int32_t		t;
+
+	flushes = d->flushes;
+	from = d->sets + s / d->ncls * GREP_WORDS;
+	if (c == 0)
+	{
+		memcpy(set, from, sizeof(set));
+		t = -2 * grep_dfa_close(d, set, s == 0, 1);
+	}
+	else if (dfa_move(d, from, c, set))
+		t = -2;
+	else
+		t = dfa_state(d, set);
+	if (t > 0 && d->nseek && !memcmp(set, d->whole.first, sizeof(set)))
+	{
+		d->idle = t;
+		t = -3;
+	}
+	if (d->flushes == flushes)
+		d->next[s + c] = t;
+	return (t);
+}
+
+size_t	grep_dfa_run(t_grepdfa *d, const unsigned char *buf, size_t len)
+{
+	int32_t	s;
+	int32_t	t;
+	size_t	i;
+
+	s = 0;
+	i = 0;
+	while (i < len)
+	{
+		t = d->next[s + d->cls[buf[i]]];
+		if (t == -1)
+			t = grep_dfa_step(d, s, d->cls[buf[i]]);
+		if (t == -2)
+			return (i);
+		if (t == -3)
+		{
+			t = d->idle;
+			i += d->find(d, buf + i + 1, len - i - 1);
+		}
+		s = t;
+		i++;
+	}
+	return (len);
+}
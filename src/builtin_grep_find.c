@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_grep_find.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:48:20 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 00:24:43 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+int	grep_verify(const t_grep *g, const unsigned char *p)
+{
+	size_t	i;
+
+	if (!(g->flags & GREP_ICASE))
+		return (!memcmp(p, g->text, g->plen));
+	i = 0;
+	while (i < g->plen && g->fold[p[i]] == g->text[i])
+		i++;
+	return (i == g->plen);
+}
+
+size_t	grep_scan(const t_grep *g, const unsigned char *buf, size_t len)
+{
+	const unsigned char	*p;
+	size_t				i;
+
+	i = 0;
+	while (i + g->plen <= len)
+	{
+		if (g->first[0] == g->first[1])
+		{
+			p = memchr(buf + i, g->first[0], len - g->plen + 1 - i);
+			if (!p)
+				return (len);
+			i = p - buf;
+		}
+		else if (buf[i] != g->first[0] && buf[i] != g->first[1])
+		{
+			i++;
+			continue ;
+		}
+		if (grep_verify(g, buf + i))
+			return (i);
+		i++;
+	}
+	return (len);
+}
+
+size_t	grep_ac_find(const t_grep *g, const unsigned char *buf, size_t len)
+{
+	const int32_t		*next;
+	const unsigned char	*cls;
+	int32_t				state;
+	size_t				i;
+
+	next = g->ac.next;
+	cls = g->ac.cls;
+	state = 0;
+	i = 0;
+	while (i < len)
+	{
+		state = next[state + cls[buf[i]]];
+		if (state < 0)
+			return (i);
+		i++;
+	}
+	return (len);
+}
+
+size_t	grep_dfa_find(const t_grep *g, const unsigned char *buf, size_t len)
+{
+	size_t	pos;
+	size_t	hit;
+	size_t	end;
+
+	if (!g->plen || g->dfa->dense >= GREP_DENSE)
+		return (grep_dfa_run(g->dfa, buf, len));
+	pos = 0;
+	while (pos < len)
+	{
+		if (g->ops)
+			hit = pos + g->ops->find(g, buf + pos, len - pos);
+		else
+			hit = pos + grep_scan(g, buf + pos, len - pos);
+		if (hit >= len)
+			return (len);
+		end = (const unsigned char *)memchr(buf + hit, '\n', len - hit) - buf;
+		while (hit > pos && buf[hit - 1] != '\n')
+			hit--;
+		g->dfa->dense = (g->dfa->dense + 1) * (hit == pos);
+		hit += grep_dfa_run(g->dfa, buf + hit, end + 1 - hit);
+		if (hit <= end)
+			return (hit);
+		pos = end + 1;
+	}
+	return (len);
+}
+
+size_t	grep_find(const t_grep *g, const unsigned char *buf, size_t len)
+{
+	if (g->match_all)
+		return (0);
+	if (!g->npats)
+		return (len);
+	if (g->dfa)
+		return (grep_dfa_find(g, buf, len));
+	if (g->npats > 1)
+		return (grep_ac_find(g, buf, len));
+	if (g->ops)
+		return (g->ops->find(g, buf, len));
+	return (grep_scan(g, buf, len));
+}
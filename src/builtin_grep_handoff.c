@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_grep_handoff.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:33:59 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:33:59 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Writes the replay and the rest of stdin to stdout, now the
+ * real grep's pipe, and waits for it.
+ *
+ * @param g The grep state.
+ * @param pid The real grep.
+ * @return Its exit status, or 2 on a read error.
+ */
+static int	grep_feed(t_grep *g, pid_t pid)
+{
+	ssize_t	n;
+	int		status;
+
+	signal(SIGPIPE, SIG_IGN);
+	n = 1;
+	if (bi_write(g->replay, g->rlen) < 0)
+		n = 0;
+	while (n > 0)
+	{
+		n = bi_read(STDIN_FILENO, g->replay, GREP_HOLD);
+		if (n > 0 && bi_write(g->replay, n) < 0)
+			n = 0;
+	}
+	if (n < 0)
+		bi_fail("grep", "(standard input)");
+	close(STDOUT_FILENO);
+	if (waitpid(pid, &status, 0) < 0 || n < 0)
+		return (2);
+	if (WIFSIGNALED(status))
+		return (128 + WTERMSIG(status));
+	return (WEXITSTATUS(status));
+}
+
+int	grep_handoff(t_grep *g)
+{
+	int		fds[2];
+	pid_t	pid;
+
+	if (g->origin >= 0 && lseek(STDIN_FILENO, g->origin, SEEK_SET) < 0)
+		return (bi_fail("grep", "(standard input)") + 1);
+	if (g->origin >= 0)
+		return (BI_EXEC);
+	if (pipe(fds) < 0)
+		return (bi_fail("grep", NULL) + 1);
+	pid = fork();
+	if (pid == 0)
+		dup2(fds[0], STDIN_FILENO);
+	else if (pid > 0)
+		dup2(fds[1], STDOUT_FILENO);
+	close(fds[0]);
+	close(fds[1]);
+	if (pid < 0)
+		return (bi_fail("grep", NULL) + 1);
+	if (pid == 0)
+		return (BI_EXEC);
+	return (grep_feed(g, pid));
+}
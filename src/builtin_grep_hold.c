@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_grep_hold.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:32:12 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:32:12 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Looks for a NUL in the rest of a regular stdin, without
+ * moving its offset.
+ *
+ * @return 1 if there is one or the file could not be read, 0 if not.
+ */
+static int	grep_ahead(void)
+{
+	char	*buf;
+	off_t	off;
+	ssize_t	n;
+
+	off = lseek(STDIN_FILENO, 0, SEEK_CUR);
+	buf = malloc(BI_BUF);
+	if (!buf || off < 0)
+	{
+		free(buf);
+		return (1);
+	}
+	n = pread(STDIN_FILENO, buf, BI_BUF, off);
+	while (n > 0 && !memchr(buf, '\0', n))
+	{
+		off += n;
+		n = pread(STDIN_FILENO, buf, BI_BUF, off);
+	}
+	free(buf);
+	return (n != 0);
+}
+
+int	grep_hold_start(t_grep *g)
+{
+	struct stat	st;
+	off_t		hole;
+
+	g->held = 1;
+	g->origin = -1;
+	if (fstat(STDIN_FILENO, &st) < 0 || !S_ISREG(st.st_mode))
+		return (0);
+	g->origin = lseek(STDIN_FILENO, 0, SEEK_CUR);
+	if (g->origin < 0)
+		return (0);
+	hole = lseek(STDIN_FILENO, g->origin, SEEK_HOLE);
+	lseek(STDIN_FILENO, g->origin, SEEK_SET);
+	if (hole >= 0 && hole < st.st_size)
+		return (GREP_REAL);
+	return (0);
+}
+
+int	grep_hold(t_grep *g, const unsigned char *p, size_t n)
+{
+	if (!g->held || g->origin >= 0)
+		return (0);
+	if (!g->replay)
+		g->replay = malloc(GREP_HOLD);
+	if (!g->replay || g->rlen + n > GREP_HOLD)
+		return (grep_release(g));
+	memcpy(g->replay + g->rlen, p, n);
+	g->rlen += n;
+	return (0);
+}
+
+int	grep_release(t_grep *g)
+{
+	int	ret;
+
+	g->held = 0;
+	free(g->replay);
+	g->replay = NULL;
+	if (g->origin >= 0)
+		return (grep_ahead());
+	ret = 0;
+	if (g->hlen && bi_write(g->hout, g->hlen) < 0)
+		ret = -1;
+	free(g->hout);
+	g->hout = NULL;
+	g->hlen = 0;
+	return (ret);
+}
+
+int	grep_spill(t_grep *g, const unsigned char *line, size_t n)
+{
+	int	ret;
+
+	if (g->origin < 0 && !g->hout)
+		g->hout = malloc(GREP_HOLD);
+	if (g->origin < 0 && g->hout && g->hlen + g->olen + n <= GREP_HOLD)
+	{
+		memcpy(g->hout + g->hlen, g->out, g->olen);
+		memcpy(g->hout + g->hlen + g->olen, line, n);
+		g->hlen += g->olen + n;
+		g->olen = 0;
+		return (0);
+	}
+	ret = grep_release(g);
+	if (ret > 0)
+		return (GREP_REAL);
+	if (ret < 0)
+		return (-1);
+	return (1);
+}
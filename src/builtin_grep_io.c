@@ -0,0 +1,165 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_grep_io.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:48:20 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:36:53 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Detects binary input and turns its NUL bytes into newlines.
+ *
+ * While the output is held, a NUL leaves the stage to the real grep
+ * instead. Past GREP_HOLD bytes of a pipe, GNU grep's output depends
+ * on how the writer's data arrives anyway; NULs are then handled as it
+ * does from the buffer where it first sees one, so -c counts the same
+ * lines.
+ *
+ * @param g The grep state.
+ * @param p Bytes just read.
+ * @param n Length of p.
+ * @return 0, or GREP_REAL to hand the stage over.
+ */
+static int	grep_zap(t_grep *g, unsigned char *p, size_t n)
+{
+	unsigned char	*nul;
+
+	nul = memchr(p, '\0', n);
+	if (nul && g->held)
+		return (GREP_REAL);
+	if (nul && !g->binary)
+		g->binary = 1;
+	while (nul)
+	{
+		*nul = '\n';
+		nul = memchr(nul + 1, '\0', n - (nul + 1 - p));
+	}
+	return (0);
+}
+
+/**
+ * @brief Returns how much to read after keep leftover bytes.
+ *
+ * Reads of a regular file end where GNU grep's do, since it keeps the
+ * leftover below a page-aligned read area, so when -m ends the search
+ * early the builtin has looked for a NUL in the same bytes.
+ *
+ * @param keep Bytes of an unfinished line at the start of the buffer.
+ * @param cap Capacity of the buffer.
+ * @return The read size.
+ */
+static size_t	grep_readsize(size_t keep, size_t cap)
+{
+	size_t	start;
+
+	start = (keep + GREP_PAGE) & ~(size_t)(GREP_PAGE - 1);
+	if (start >= cap)
+		return (cap - keep);
+	return (cap - start);
+}
+
+/**
+ * @brief Searches the whole lines of the buffer after n bytes were
+ * read behind keep leftover ones, and keeps the unfinished one.
+ *
+ * @param g The grep state.
+ * @param buf The buffer.
+ * @param keep Leftover bytes, updated.
+ * @param n Bytes just read.
+ * @return The result of grep_lines, or 0.
+ */
+static int	grep_chunk(t_grep *g, unsigned char *buf, size_t *keep, size_t n)
+{
+	unsigned char	*nl;
+	int				ret;
+
+	ret = grep_hold(g, buf + *keep, n);
+	if (!ret && grep_zap(g, buf + *keep, n))
+		ret = GREP_REAL;
+	if (ret)
+		return (ret);
+	nl = memrchr(buf + *keep, '\n', n);
+	*keep += n;
+	if (!nl)
+		return (0);
+	ret = grep_lines(g, buf, nl + 1 - buf);
+	*keep -= nl + 1 - buf;
+	memmove(buf, nl + 1, *keep);
+	return (ret);
+}
+
+/**
+ * @brief Reads stdin and hands its whole lines to grep_lines.
+ *
+ * A line longer than the buffer grows it; a last line without a
+ * newline is searched as if it had one.
+ *
+ * @param g The grep state.
+ * @param buf The buffer, of cap + 1 bytes; freed.
+ * @param cap Its capacity.
+ * @return 0 on success, 1 when stopped early, -1 on a write error,
+ * -2 on a read or allocation error, GREP_REAL on binary input.
+ */
+static int	grep_stream(t_grep *g, unsigned char *buf, size_t cap)
+{
+	size_t	keep;
+	ssize_t	n;
+	int		ret;
+
+	keep = 0;
+	ret = 0;
+	n = bi_read(STDIN_FILENO, (char *)buf, grep_readsize(0, cap));
+	while (n > 0 && !ret)
+	{
+		ret = grep_chunk(g, buf, &keep, n);
+		if (keep == cap)
+			buf = (unsigned char *)grep_grow((char *)buf, keep, &cap);
+		if (!buf)
+			return (-2);
+		if (!ret)
+			n = bi_read(STDIN_FILENO, (char *)buf + keep,
+					grep_readsize(keep, cap));
+	}
+	if (n < 0)
+		ret = -2;
+	buf[keep] = '\n';
+	if (!ret && keep)
+		ret = grep_lines(g, buf, keep + 1);
+	free(buf);
+	return (ret);
+}
+
+int	bi_grep(t_bargs *args)
+{
+	static t_grep	g;
+	unsigned char	*buf;
+	int				ret;
+
+	if (args->count == 0)
+		return (1);
+	if (grep_setup(args, &g) < 0)
+	{
+		grep_free(&g);
+		bi_fail("grep", NULL);
+		return (2);
+	}
+	ret = grep_hold_start(&g);
+	buf = NULL;
+	if (!ret)
+		buf = malloc(GREP_READ + GREP_PAGE + 1);
+	if (buf)
+		ret = grep_stream(&g, buf, GREP_READ + GREP_PAGE);
+	else if (!ret)
+		ret = -2;
+	if (ret == GREP_REAL)
+		return (grep_handoff(&g));
+	ret = grep_finish(&g, ret);
+	grep_free(&g);
+	return (ret);
+}
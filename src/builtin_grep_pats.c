@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_grep_pats.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:48:20 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/17 23:54:18 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+char	*grep_grow(char *buf, size_t len, size_t *cap)
+{
+	char	*grown;
+
+	grown = malloc(*cap * 2 + 1);
+	if (grown)
+		memcpy(grown, buf, len);
+	free(buf);
+	*cap *= 2;
+	return (grown);
+}
+
+char	*grep_load(const char *path, size_t *len)
+{
+	struct stat	st;
+	char		*data;
+	ssize_t		bytes;
+	int			fd;
+
+	fd = open(path, O_RDONLY | O_CLOEXEC);
+	data = NULL;
+	if (fd >= 0 && !fstat(fd, &st) && S_ISREG(st.st_mode))
+		data = malloc(st.st_size + 1);
+	*len = 0;
+	bytes = 1;
+	while (data && bytes > 0 && *len < (size_t)st.st_size)
+	{
+		bytes = bi_read(fd, data + *len, st.st_size - *len);
+		*len += (bytes > 0) * bytes;
+	}
+	if (fd >= 0)
+		close(fd);
+	if (data && bytes < 0)
+		free(data);
+	if (data && bytes < 0)
+		return (NULL);
+	if (data)
+		data[*len] = '\0';
+	return (data);
+}
+
+/**
+ * @brief Appends a block of patterns, each ending in a newline.
+ *
+ * @param g The grep state; text must have room.
+ * @param src The patterns, one per line.
+ * @param len Length of src.
+ * @param file 1 if src is a -f file, whose last newline ends a pattern.
+ */
+static void	grep_append(t_grep *g, const char *src, size_t len, int file)
+{
+	if (file && !len)
+		return ;
+	if (file && src[len - 1] == '\n')
+		len--;
+	memcpy(g->text + g->len, src, len);
+	g->len += len;
+	g->text[g->len++] = '\n';
+}
+
+int	grep_join(t_bargs *args, t_grep *g)
+{
+	char	*data;
+	size_t	data_len;
+	size_t	total;
+	int		i;
+
+	data = NULL;
+	data_len = 0;
+	if (args->pat_file)
+		data = grep_load(args->pat_file, &data_len);
+	if (args->pat_file && !data)
+		return (-1);
+	total = data_len + 1;
+	i = -1;
+	while (++i < args->npats)
+		total += ft_strlen(args->pats[i]) + 1;
+	g->text = malloc(total);
+	i = -1;
+	while (g->text && ++i < args->npats)
+		grep_append(g, args->pats[i], ft_strlen(args->pats[i]), 0);
+	if (g->text && data)
+		grep_append(g, data, data_len, 1);
+	free(data);
+	return (-!g->text);
+}
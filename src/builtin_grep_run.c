@@ -0,0 +1,154 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_grep_run.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:48:20 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:36:53 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Buffers a selected line for output.
+ *
+ * In a UTF-8 locale a line that is not valid UTF-8 is left out, as GNU
+ * grep does, and reported once at the end.
+ *
+ * @param g The grep state.
+ * @param line The line, with its newline.
+ * @param n Length of line.
+ * @return 0 on success, -1 on a write error, GREP_REAL when the
+ * output cannot be released.
+ */
+static int	grep_emit(t_grep *g, const unsigned char *line, size_t n)
+{
+	int	ret;
+
+	if (g->utf8 && !bi_utf8_valid((const char *)line, n))
+	{
+		g->enc_err = 1;
+		return (0);
+	}
+	ret = 1;
+	if (g->olen + n > sizeof(g->out) && g->held)
+		ret = grep_spill(g, line, n);
+	if (ret < 1)
+		return (ret);
+	if (g->olen + n > sizeof(g->out))
+	{
+		if (bi_write(g->out, g->olen) < 0)
+			return (-1);
+		g->olen = 0;
+	}
+	if (n > sizeof(g->out))
+		return (bi_write((const char *)line, n));
+	memcpy(g->out + g->olen, line, n);
+	g->olen += n;
+	return (0);
+}
+
+/**
+ * @brief Counts a selected line and prints it unless -c is given.
+ *
+ * On binary input the first selected line ends the search instead.
+ *
+ * @param g The grep state.
+ * @param line The line, with its newline.
+ * @param n Length of line.
+ * @return 0 to go on, 1 when done, -1 on a write error, GREP_REAL on
+ * binary input.
+ */
+static int	grep_select(t_grep *g, const unsigned char *line, size_t n)
+{
+	int	ret;
+
+	g->selected++;
+	if (!(g->flags & GREP_COUNT) && g->binary)
+	{
+		g->binary = 2;
+		return (1);
+	}
+	ret = 0;
+	if (!(g->flags & GREP_COUNT))
+		ret = grep_emit(g, line, n);
+	if (ret < 0)
+		return (ret);
+	return (g->max >= 0 && g->selected >= g->max);
+}
+
+/**
+ * @brief Selects every line of a block with no match, for -v.
+ *
+ * @param g The grep state.
+ * @param buf Whole lines.
+ * @param len Length of buf.
+ * @return 0 to go on, 1 when done, -1 on a write error, GREP_REAL on
+ * binary input.
+ */
+static int	grep_invert(t_grep *g, const unsigned char *buf, size_t len)
+{
+	const unsigned char	*end;
+	int					ret;
+
+	ret = 0;
+	while (len && !ret)
+	{
+		end = memchr(buf, '\n', len);
+		ret = grep_select(g, buf, end + 1 - buf);
+		len -= end + 1 - buf;
+		buf = end + 1;
+	}
+	return (ret);
+}
+
+int	grep_lines(t_grep *g, const unsigned char *buf, size_t len)
+{
+	const unsigned char	*start;
+	const unsigned char	*end;
+	size_t				hit;
+	int					ret;
+
+	ret = 0;
+	while (len && !ret)
+	{
+		hit = grep_find(g, buf, len);
+		start = buf;
+		if (hit < len && hit && memrchr(buf, '\n', hit))
+			start = (const unsigned char *)memrchr(buf, '\n', hit) + 1;
+		if (hit >= len)
+			start = buf + len;
+		if (g->flags & GREP_INVERT)
+			ret = grep_invert(g, buf, start - buf);
+		if (hit >= len || ret)
+			break ;
+		end = (const unsigned char *)memchr(buf + hit, '\n', len - hit) + 1;
+		if (!(g->flags & GREP_INVERT))
+			ret = grep_select(g, start, end - start);
+		len -= end - buf;
+		buf = end;
+	}
+	return (ret);
+}
+
+int	grep_finish(t_grep *g, int ret)
+{
+	if (ret >= 0 && (g->flags & GREP_COUNT))
+		g->olen = snprintf(g->out, sizeof(g->out), "%lld\n", g->selected);
+	if (ret >= 0 && g->hlen && bi_write(g->hout, g->hlen) < 0)
+		ret = -1;
+	if (ret >= 0 && g->olen && bi_write(g->out, g->olen) < 0)
+		ret = -1;
+	if (ret == -1)
+		bi_fail("grep", "write error");
+	if (ret == -2)
+		bi_fail("grep", "(standard input)");
+	if (ret >= 0 && (g->binary == 2 || g->enc_err))
+		write(STDERR_FILENO, GREP_BINARY, ft_strlen(GREP_BINARY));
+	if (ret < 0)
+		return (2);
+	return (g->selected == 0);
+}
@@ -0,0 +1,165 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_grep_rx.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:04:18 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 00:24:43 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Parses an atom: a group, a byte set or an anchor.
+ *
+ * @param ps The parser.
+ * @param f Receives the atom.
+ * @return The byte of a one-byte literal, RX_LPAREN for a group, the
+ * token of any other atom, or RX_ERR.
+ */
+static int	rx_atom(t_rxparse *ps, t_rxfrag *f)
+{
+	uint64_t	set[4];
+	int			tok;
+	int			len;
+
+	tok = rx_peek(ps, &len);
+	ps->p += len;
+	ps->start = 2 * (tok == RX_BOL);
+	if (tok == RX_LPAREN)
+	{
+		ps->depth++;
+		if (rx_alt(ps, f) < 0 || rx_peek(ps, &len) != RX_RPAREN)
+			return (RX_ERR);
+		ps->p += len;
+		ps->depth--;
+		ps->start = 0;
+		return (RX_LPAREN);
+	}
+	if ((tok == RX_BOL || tok == RX_EOL) && rx_pos(ps->dfa, tok, NULL, f) == 0)
+		return (tok);
+	if (tok < 0 || (tok > 255 && tok != RX_ANY && tok != RX_BRACKET
+			&& tok != RX_CLASS) || rx_set(ps, tok, set) < 0
+		|| rx_pos(ps->dfa, 0, set, f) < 0)
+		return (RX_ERR);
+	return (tok);
+}
+
+/**
+ * @brief Applies an interval to a piece.
+ *
+ * Each copy past the first parses the piece again, so it gets its own
+ * positions: a{2,4} is built as a a a? a? and a{2,} as a a+.
+ *
+ * @param ps The parser, after the opening brace.
+ * @param f The piece, parsed once; becomes the repetition.
+ * @param s Start of the piece.
+ * @param q Start of the interval.
+ * @return 0 on success, -1 otherwise.
+ */
+static int	rx_repeat(t_rxparse *ps, t_rxfrag *f, const unsigned char *s,
+	const unsigned char *q)
+{
+	const unsigned char	*after;
+	t_rxfrag			copy;
+	int					lo;
+	int					hi;
+	int					i;
+
+	if (rx_bound(ps, &lo, &hi) < 0)
+		return (-1);
+	after = ps->p;
+	copy = *f;
+	memset(f, 0, sizeof(*f));
+	f->nullable = 1;
+	i = -1;
+	while (++i < hi || (hi < 0 && i < lo + !lo))
+	{
+		if (i > 0 && rx_piece(ps, &copy, s, q) == RX_ERR)
+			return (-1);
+		copy.nullable |= (i >= lo);
+		if (hi < 0 && i == lo - !!lo)
+			rx_link(ps->dfa, copy.last, copy.first);
+		rx_cat(ps->dfa, f, &copy);
+	}
+	ps->p = after;
+	return (0);
+}
+
+int	rx_piece(t_rxparse *ps, t_rxfrag *f, const unsigned char *s,
+	const unsigned char *stop)
+{
+	int	atom;
+	int	lit;
+	int	tok;
+	int	len;
+
+	ps->p = s;
+	atom = rx_atom(ps, f);
+	lit = atom;
+	tok = rx_peek(ps, &len);
+	while (atom >= 0 && (atom < RX_BOL || atom > RX_EOL) && ps->p < stop
+		&& tok >= RX_LBRACE && tok <= RX_STAR && tok != RX_ALT)
+	{
+		ps->p += len;
+		if (tok == RX_STAR || tok == RX_PLUS)
+			rx_link(ps->dfa, f->last, f->first);
+		f->nullable |= (tok == RX_STAR || tok == RX_QMARK);
+		if (tok == RX_LBRACE && rx_repeat(ps, f, s, ps->p - len) < 0)
+			return (RX_ERR);
+		lit = (lit | 512) * (tok == RX_PLUS) - (tok != RX_PLUS);
+		tok = rx_peek(ps, &len);
+	}
+	if (stop == ps->end)
+		rx_must(ps, lit & 511, lit != atom || atom > 255);
+	return (atom);
+}
+
+/**
+ * @brief Parses a concatenation of pieces, up to |, ) or the end.
+ *
+ * @param ps The parser.
+ * @param f Receives the concatenation.
+ * @return 0 on success, -1 otherwise.
+ */
+static int	rx_seq(t_rxparse *ps, t_rxfrag *f)
+{
+	t_rxfrag	piece;
+	int			tok;
+	int			len;
+
+	memset(f, 0, sizeof(*f));
+	f->nullable = 1;
+	ps->start = 1;
+	tok = rx_peek(ps, &len);
+	while (tok != RX_EOF && tok != RX_ALT && tok != RX_RPAREN)
+	{
+		if (rx_piece(ps, &piece, ps->p, ps->end) == RX_ERR)
+			return (-1);
+		rx_cat(ps->dfa, f, &piece);
+		tok = rx_peek(ps, &len);
+	}
+	rx_must(ps, -1, 1);
+	return (0);
+}
+
+int	rx_alt(t_rxparse *ps, t_rxfrag *f)
+{
+	t_rxfrag	branch;
+	int			len;
+
+	if (rx_seq(ps, f) < 0)
+		return (-1);
+	while (rx_peek(ps, &len) == RX_ALT)
+	{
+		ps->p += len;
+		ps->dfa->nomust |= !ps->depth;
+		if (rx_seq(ps, &branch) < 0)
+			return (-1);
+		rx_union(f, &branch);
+	}
+	return (0);
+}
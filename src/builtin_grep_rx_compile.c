@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_grep_rx_compile.c                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:04:19 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 00:24:43 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+void	grep_rx_init(t_grepdfa *d, int flags, int utf8)
+{
+	memset(d, 0, sizeof(*d));
+	d->flags = flags;
+	d->utf8 = utf8;
+}
+
+int	grep_rx_parse(t_grepdfa *d, const char *text, size_t len)
+{
+	t_rxparse			ps;
+	t_rxfrag			f;
+	const unsigned char	*end;
+	const unsigned char	*nl;
+	int					tok;
+
+	ps.dfa = d;
+	ps.p = (const unsigned char *)text;
+	end = ps.p + len;
+	while (1)
+	{
+		nl = memchr(ps.p, '\n', end - ps.p);
+		ps.end = end;
+		if (nl)
+			ps.end = nl;
+		ps.depth = 0;
+		ps.runlen = 0;
+		if (rx_alt(&ps, &f) < 0 || rx_peek(&ps, &tok) != RX_EOF)
+			return (-1);
+		rx_union(&d->whole, &f);
+		d->npats++;
+		if (!nl)
+			return (0);
+		ps.p = nl + 1;
+	}
+}
+
+/**
+ * @brief Groups the bytes that every position treats alike.
+ *
+ * The newline is class 0 on its own, since it ends a line.
+ *
+ * @param d The automaton.
+ */
+static void	rx_classes(t_grepdfa *d)
+{
+	uint64_t	sig[256][GREP_WORDS];
+	int			b;
+	int			p;
+	int			k;
+
+	memset(sig, 0, sizeof(sig));
+	p = -1;
+	while (++p < d->npos)
+	{
+		b = -1;
+		while (++b < 256)
+			if (d->set[p][b / 64] >> (b % 64) & 1)
+				sig[b][p / 64] |= 1ULL << (p % 64);
+	}
+	d->ncls = 1;
+	b = -1;
+	while (++b < 256)
+	{
+		k = 1;
+		while (k < d->ncls && memcmp(sig[b], sig[d->rep[k]], sizeof(sig[b])))
+			k++;
+		if (k == d->ncls && b != '\n')
+			d->rep[d->ncls++] = b;
+		d->cls[b] = k * (b != '\n');
+	}
+}
+
+/**
+ * @brief Adds the final position, the byte classes and the start state.
+ *
+ * @param d The automaton, with every pattern parsed.
+ * @return 1 if the start state already matches, 0 if not, -1 on
+ * allocation failure.
+ */
+static int	rx_finish(t_grepdfa *d)
+{
+	t_rxfrag	end;
+
+	rx_pos(d, RX_EOF, NULL, &end);
+	rx_cat(d, &d->whole, &end);
+	rx_classes(d);
+	d->next = malloc(GREP_DFA * d->ncls * sizeof(int32_t));
+	d->sets = malloc(GREP_DFA * GREP_WORDS * sizeof(uint64_t));
+	d->slots = malloc(GREP_DFA * 2 * sizeof(int32_t));
+	if (!d->next || !d->sets || !d->slots)
+		return (-1);
+	memset(d->next, 0xff, GREP_DFA * d->ncls * sizeof(int32_t));
+	memset(d->slots, 0xff, GREP_DFA * 2 * sizeof(int32_t));
+	d->nstates = 1;
+	memcpy(d->sets, d->whole.first, sizeof(d->whole.first));
+	grep_dfa_seekset(d);
+	return (grep_dfa_close(d, d->sets, 1, 0));
+}
+
+int	grep_rx_compile(t_grep *g)
+{
+	t_grepdfa	*d;
+	int			ret;
+
+	d = malloc(sizeof(t_grepdfa));
+	g->dfa = d;
+	if (!d)
+		return (-1);
+	grep_rx_init(d, g->flags, g->utf8);
+	ret = -1;
+	if (grep_rx_parse(d, (const char *)g->text, g->len - 1) == 0)
+		ret = rx_finish(d);
+	if (ret < 0)
+		return (-1);
+	g->match_all = ret;
+	if (d->nomust || d->npats > 1)
+		d->mustlen = 0;
+	memcpy(g->text, d->must, d->mustlen);
+	g->len = d->mustlen + 1;
+	return (0);
+}
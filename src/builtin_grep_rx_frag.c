@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_grep_rx_frag.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:04:19 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 00:24:43 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+int	rx_pos(t_grepdfa *d, int kind, const uint64_t *set, t_rxfrag *f)
+{
+	int	p;
+
+	if (d->npos >= GREP_POS - (kind != RX_EOF))
+		return (-1);
+	p = d->npos++;
+	d->kind[p] = kind;
+	memset(d->set[p], 0, sizeof(d->set[p]));
+	if (set)
+		memcpy(d->set[p], set, sizeof(d->set[p]));
+	memset(f, 0, sizeof(*f));
+	f->first[p / 64] = 1ULL << (p % 64);
+	f->last[p / 64] = f->first[p / 64];
+	return (0);
+}
+
+void	rx_link(t_grepdfa *d, const uint64_t *from, const uint64_t *to)
+{
+	int	p;
+	int	w;
+
+	p = -1;
+	while (++p < d->npos)
+	{
+		w = -1;
+		while ((from[p / 64] >> (p % 64) & 1) && ++w < GREP_WORDS)
+			d->follow[p][w] |= to[w];
+	}
+}
+
+void	rx_cat(t_grepdfa *d, t_rxfrag *a, const t_rxfrag *b)
+{
+	int	w;
+
+	rx_link(d, a->last, b->first);
+	w = -1;
+	while (++w < GREP_WORDS)
+	{
+		if (a->nullable)
+			a->first[w] |= b->first[w];
+		if (!b->nullable)
+			a->last[w] = 0;
+		a->last[w] |= b->last[w];
+	}
+	a->nullable &= b->nullable;
+}
+
+void	rx_union(t_rxfrag *a, const t_rxfrag *b)
+{
+	int	w;
+
+	w = -1;
+	while (++w < GREP_WORDS)
+	{
+		a->first[w] |= b->first[w];
+		a->last[w] |= b->last[w];
+	}
+	a->nullable |= b->nullable;
+}
+
+void	rx_must(t_rxparse *ps, int c, int brk)
+{
+	t_grepdfa	*d;
+
+	d = ps->dfa;
+	if (ps->depth)
+		return ;
+	if (c >= 0 && c < 256 && (d->flags & GREP_ICASE))
+		c = tolower(c);
+	if (c >= 0 && c < 256)
+		ps->run[ps->runlen++] = c;
+	if (!brk)
+		return ;
+	if (ps->runlen > d->mustlen)
+	{
+		memcpy(d->must, ps->run, ps->runlen);
+		d->mustlen = ps->runlen;
+	}
+	ps->runlen = 0;
+}
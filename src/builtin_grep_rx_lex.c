@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_grep_rx_lex.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:04:18 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 00:24:43 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Reads a backslash escape.
+ *
+ * An escaped metacharacter is literal, and in a BRE \( \) \{ \| \+ \?
+ * are the operators. \w, \W, \s and \S are byte classes; any other
+ * escape, such as a back-reference, is left to the real grep.
+ *
+ * @param ps The parser, at the backslash.
+ * @param len Receives the length of the escape.
+ * @return The token.
+ */
+static int	rx_escape(const t_rxparse *ps, int *len)
+{
+	const unsigned char	*p;
+	char				*ops;
+	char				*lit;
+
+	p = ps->p;
+	*len = 2;
+	ops = "(){|+?";
+	lit = ".[]*^$\\";
+	if (ps->dfa->flags & GREP_EXT)
+		lit = ".[]*^$\\(){}|+?";
+	if (p + 1 >= ps->end || !p[1])
+		return (RX_ERR);
+	if (ft_strchr("wWsS", p[1]))
+		return (RX_CLASS);
+	if (!(ps->dfa->flags & GREP_EXT) && ft_strchr(ops, p[1]))
+		return (RX_LPAREN + (ft_strchr(ops, p[1]) - ops));
+	if (ft_strchr(lit, p[1]))
+		return (p[1]);
+	return (RX_ERR);
+}
+
+/**
+ * @brief Reads an unescaped byte of a BRE.
+ *
+ * As in GNU grep, * is literal where start is set, ^ is an anchor
+ * only at the start of the pattern, a group or a branch, and $ only
+ * at the end or before a ) or |, escaped or not, with a byte after.
+ *
+ * @param ps The parser.
+ * @return The token.
+ */
+static int	rx_bre(const t_rxparse *ps)
+{
+	const unsigned char	*p;
+
+	p = ps->p;
+	if (*p == '*' && !ps->start)
+		return (RX_STAR);
+	if (*p == '^' && ps->start == 1)
+		return (RX_BOL);
+	if (*p == '$' && (p + 1 == ps->end || (p + 2 < ps->end
+				&& (p[1 + (p[1] == '\\')] == ')'
+					|| p[1 + (p[1] == '\\')] == '|'))))
+		return (RX_EOL);
+	if (*p == '.')
+		return (RX_ANY);
+	if (*p == '[')
+		return (RX_BRACKET);
+	return (*p);
+}
+
+int	rx_peek(const t_rxparse *ps, int *len)
+{
+	char	*ops;
+	int		tok;
+
+	*len = 1;
+	ops = "(){|+?*^$.[";
+	if (ps->p >= ps->end)
+		return (RX_EOF);
+	tok = *ps->p;
+	if (tok == '\\')
+		tok = rx_escape(ps, len);
+	else if (!(ps->dfa->flags & GREP_EXT))
+		tok = rx_bre(ps);
+	else if (tok && ft_strchr(ops, tok))
+		tok = RX_LPAREN + (ft_strchr(ops, tok) - ops);
+	if (tok == RX_RPAREN && !ps->depth && *ps->p == ')')
+		tok = ')';
+	if (ps->dfa->utf8 && ((tok > 127 && tok < 256) || tok == RX_ANY
+			|| tok == RX_CLASS))
+		return (RX_ERR);
+	return (tok);
+}
+
+/**
+ * @brief Reads a decimal interval bound.
+ *
+ * @param p Cursor; advanced past the digits.
+ * @param end End of the pattern.
+ * @param val Receives the bound, which stops growing past GREP_POS.
+ * @return The number of digits read.
+ */
+static int	rx_num(const unsigned char **p, const unsigned char *end,
+	int *val)
+{
+	int	n;
+
+	n = 0;
+	*val = 0;
+	while (*p < end && ft_isdigit(**p) && *val <= GREP_POS)
+	{
+		*val = *val * 10 + (*(*p)++ - '0');
+		n++;
+	}
+	return (n);
+}
+
+int	rx_bound(t_rxparse *ps, int *lo, int *hi)
+{
+	const unsigned char	*p;
+	int					n;
+
+	p = ps->p;
+	n = rx_num(&p, ps->end, lo);
+	*hi = *lo;
+	if (p < ps->end && *p == ',')
+	{
+		p++;
+		n++;
+		if (!rx_num(&p, ps->end, hi))
+			*hi = -1;
+	}
+	if (!(ps->dfa->flags & GREP_EXT) && (p >= ps->end || *p++ != '\\'))
+		return (-1);
+	if (!n || p >= ps->end || *p != '}' || *lo > GREP_POS || *hi > GREP_POS
+		|| (*hi >= 0 && *hi < *lo))
+		return (-1);
+	ps->p = p + 1;
+	return (0);
+}
@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_grep_rx_set.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:04:19 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 00:24:43 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Adds the bytes lo to hi to a set, in both cases with -i.
+ *
+ * @param d The automaton.
+ * @param set The byte set.
+ * @param lo First byte.
+ * @param hi Last byte.
+ */
+static void	rx_add(const t_grepdfa *d, uint64_t *set, int lo, int hi)
+{
+	int	c;
+
+	while (lo <= hi)
+	{
+		c = lo;
+		if (d->flags & GREP_ICASE)
+			c = tolower(lo);
+		set[c / 64] |= 1ULL << (c % 64);
+		if (d->flags & GREP_ICASE)
+			c = toupper(lo);
+		set[c / 64] |= 1ULL << (c % 64);
+		lo++;
+	}
+}
+
+/**
+ * @brief Adds a [:class:] bracket item.
+ *
+ * Equivalence classes, collating symbols and, outside the C locale,
+ * every class are left to the real grep.
+ *
+ * @param ps The parser, at the item's opening bracket.
+ * @param set The byte set.
+ * @return 0 on success, -1 otherwise.
+ */
+static int	rx_cclass(t_rxparse *ps, uint64_t *set)
+{
+	const unsigned char	*e;
+	t_ctype				is;
+	int					c;
+
+	e = ps->p + 2;
+	while (e + 1 < ps->end && (e[0] != ':' || e[1] != ']'))
+		e++;
+	is = NULL;
+	if (ps->p[1] == ':' && e + 1 < ps->end && !ps->dfa->utf8)
+		is = bi_ctype((const char *)ps->p + 2, e - ps->p - 2);
+	if (!is)
+		return (-1);
+	c = -1;
+	while (++c < 256)
+		if (is(c))
+			rx_add(ps->dfa, set, c, c);
+	ps->p = e + 2;
+	return (0);
+}
+
+/**
+ * @brief Adds one bracket item: a class, a range or a byte.
+ *
+ * @param ps The parser, at the item.
+ * @param set The byte set.
+ * @return 0 on success, -1 for syntax left to the real grep.
+ */
+static int	rx_item(t_rxparse *ps, uint64_t *set)
+{
+	const unsigned char	*p;
+	int					hi;
+
+	p = ps->p;
+	if (p + 1 < ps->end && *p == '['
+		&& (p[1] == ':' || p[1] == '.' || p[1] == '='))
+		return (rx_cclass(ps, set));
+	hi = *p;
+	ps->p = p + 1;
+	if (p + 2 < ps->end && p[1] == '-' && p[2] != ']')
+	{
+		hi = p[2];
+		ps->p = p + 3;
+	}
+	if ((ps->p == p + 3 && (hi < *p || hi == '['))
+		|| (ps->dfa->utf8 && (*p > 127 || hi > 127)))
+		return (-1);
+	rx_add(ps->dfa, set, *p, hi);
+	return (0);
+}
+
+int	rx_bracket(t_rxparse *ps, uint64_t *set)
+{
+	int	neg;
+	int	first;
+
+	neg = (ps->p < ps->end && *ps->p == '^');
+	ps->p += neg;
+	first = 1;
+	while (ps->p < ps->end && (*ps->p != ']' || first))
+	{
+		if (rx_item(ps, set) < 0)
+			return (-1);
+		first = 0;
+	}
+	if (ps->p >= ps->end || (neg && ps->dfa->utf8))
+		return (-1);
+	ps->p++;
+	return (neg);
+}
+
+int	rx_set(t_rxparse *ps, int tok, uint64_t *set)
+{
+	static const char	*esc[] = {"_[:alnum:]]", "^_[:alnum:]]",
+		"[:space:]]", "^[:space:]]"};
+	t_rxparse			sub;
+	int					neg;
+
+	memset(set, 0, sizeof(uint64_t) * 4);
+	neg = (tok == RX_ANY);
+	if (tok < 256)
+		rx_add(ps->dfa, set, tok, tok);
+	if (tok == RX_BRACKET)
+		neg = rx_bracket(ps, set);
+	if (tok == RX_CLASS)
+	{
+		sub = *ps;
+		sub.p = (const unsigned char *)esc[2 * (tolower(ps->p[-1]) == 's')
+			+ !!isupper(ps->p[-1])];
+		sub.end = sub.p + ft_strlen((const char *)sub.p);
+		neg = rx_bracket(&sub, set);
+	}
+	tok = -1;
+	while (neg > 0 && ++tok < 4)
+		set[tok] = ~set[tok];
+	set['\n' / 64] &= ~(1ULL << ('\n' % 64));
+	return (-(neg < 0));
+}
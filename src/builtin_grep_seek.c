@@ -0,0 +1,166 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_grep_seek.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:17:40 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 00:24:43 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Finds the next byte that leaves the idle state, one at a time.
+ *
+ * @param d The automaton.
+ * @param buf The bytes.
+ * @param len Length of buf.
+ * @return The offset of the byte, or len if none.
+ */
+static size_t	dfa_seek_scalar(const t_grepdfa *d, const unsigned char *buf,
+	size_t len)
+{
+	const unsigned char	*p;
+	size_t				i;
+
+	if (d->nseek == 1)
+	{
+		p = memchr(buf, '\n', len);
+		if (!p)
+			return (len);
+		return (p - buf);
+	}
+	i = 0;
+	while (i < len && !memchr(d->seek, buf[i], GREP_SEEK))
+		i++;
+	return (i);
+}
+
+#if defined(__x86_64__)
+# include <immintrin.h>
+
+/**
+ * @brief Finds the next byte that leaves the idle state, 16 at a time
+ * with SSE2.
+ *
+ * @param d The automaton.
+ * @param buf The bytes.
+ * @param len Length of buf.
+ * @return The offset of the byte, or len if none.
+ */
+static size_t	dfa_seek_sse2(const t_grepdfa *d, const unsigned char *buf,
+	size_t len)
+{
+	__m128i		v;
+	__m128i		m;
+	uint32_t	mask;
+	size_t		i;
+	int			k;
+
+	i = 0;
+	while (i + 16 <= len)
+	{
+		v = _mm_loadu_si128((const __m128i *)(buf + i));
+		m = _mm_setzero_si128();
+		k = -1;
+		while (++k < GREP_SEEK)
+			m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8(d->seek[k])));
+		mask = _mm_movemask_epi8(m);
+		if (mask)
+			return (i + __builtin_ctz(mask));
+		i += 16;
+	}
+	return (i + dfa_seek_scalar(d, buf + i, len - i));
+}
+
+/**
+ * @brief Finds the next byte that leaves the idle state, 32 at a time
+ * with AVX2.
+ *
+ * @param d The automaton.
+ * @param buf The bytes.
+ * @param len Length of buf.
+ * @return The offset of the byte, or len if none.
+ */
+__attribute__((target("avx2")))
+static size_t	dfa_seek_avx2(const t_grepdfa *d, const unsigned char *buf,
+	size_t len)
+{
+	__m256i		v;
+	__m256i		m;
+	uint32_t	mask;
+	size_t		i;
+	int			k;
+
+	i = 0;
+	while (i + 32 <= len)
+	{
+		v = _mm256_loadu_si256((const __m256i *)(buf + i));
+		m = _mm256_setzero_si256();
+		k = -1;
+		while (++k < GREP_SEEK)
+			m = _mm256_or_si256(m,
+					_mm256_cmpeq_epi8(v, _mm256_set1_epi8(d->seek[k])));
+		mask = _mm256_movemask_epi8(m);
+		if (mask)
+			return (i + __builtin_ctz(mask));
+		i += 32;
+	}
+	return (i + dfa_seek_scalar(d, buf + i, len - i));
+}
+
+/**
+ * @brief Picks the seek kernel: memchr for the newline alone, else the
+ * widest vector compare the CPU has.
+ *
+ * @param d The automaton, with seek filled.
+ */
+static void	dfa_seek_kernel(t_grepdfa *d)
+{
+	d->find = dfa_seek_scalar;
+	if (d->nseek == 1)
+		return ;
+	d->find = dfa_seek_sse2;
+	if (__builtin_cpu_supports("avx2"))
+		d->find = dfa_seek_avx2;
+}
+
+#else
+
+static void	dfa_seek_kernel(t_grepdfa *d)
+{
+	d->find = dfa_seek_scalar;
+}
+
+#endif
+
+void	grep_dfa_seekset(t_grepdfa *d)
+{
+	int	p;
+	int	b;
+
+	memset(d->seek, '\n', GREP_SEEK);
+	d->nseek = 1;
+	p = -1;
+	while (++p < d->npos && d->nseek <= GREP_SEEK)
+	{
+		if (!(d->whole.first[p / 64] >> (p % 64) & 1) || d->kind[p])
+			continue ;
+		b = -1;
+		while (++b < 256 && d->nseek <= GREP_SEEK)
+		{
+			if (!(d->set[p][b / 64] >> (b % 64) & 1)
+				|| memchr(d->seek, b, d->nseek))
+				continue ;
+			if (d->nseek < GREP_SEEK)
+				d->seek[d->nseek] = b;
+			d->nseek++;
+		}
+	}
+	if (d->nseek > GREP_SEEK)
+		d->nseek = 0;
+	dfa_seek_kernel(d);
+}
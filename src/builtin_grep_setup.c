@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_grep_setup.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:48:20 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:36:53 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Case-folds the patterns with -i and counts them.
+ *
+ * Also notes an empty pattern, which matches every line. Regex
+ * patterns are left as they are; their byte sets are folded instead.
+ *
+ * @param g The grep state, with text and len set.
+ */
+static void	grep_fold(t_grep *g)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < 256)
+	{
+		g->fold[i] = i;
+		if (g->flags & GREP_ICASE)
+			g->fold[i] = tolower(i);
+		i++;
+	}
+	i = 0;
+	while (i < g->len)
+	{
+		if (!(g->flags & GREP_REGEX))
+			g->text[i] = g->fold[g->text[i]];
+		if (g->text[i] == '\n' && (i == 0 || g->text[i - 1] == '\n'))
+			g->match_all = 1;
+		g->npats += (g->text[i] == '\n');
+		i++;
+	}
+}
+
+/**
+ * @brief Prepares the prefilter bytes and kernel of a single pattern.
+ *
+ * @param g The grep state.
+ */
+static void	grep_single(t_grep *g)
+{
+	g->plen = g->len - 1;
+	g->first[0] = g->text[0];
+	g->first[1] = g->text[0];
+	g->last[0] = g->text[g->plen - 1];
+	g->last[1] = g->text[g->plen - 1];
+	if (g->flags & GREP_ICASE)
+	{
+		g->first[1] = toupper(g->first[0]);
+		g->last[1] = toupper(g->last[0]);
+	}
+	g->ops = grep_kernel();
+}
+
+int	grep_setup(t_bargs *args, t_grep *g)
+{
+	memset(g, 0, offsetof(t_grep, out));
+	g->flags = args->mode;
+	g->max = args->count;
+	g->utf8 = !bi_c_locale();
+	if (grep_join(args, g) < 0)
+		return (-1);
+	grep_fold(g);
+	if (g->match_all || !g->npats)
+		return (0);
+	if (g->flags & GREP_REGEX)
+	{
+		if (grep_rx_compile(g) < 0)
+			return (-1);
+		if (g->len > 1)
+			grep_single(g);
+		return (0);
+	}
+	if (g->npats > 1)
+		return (grep_ac_build(g));
+	grep_single(g);
+	return (0);
+}
+
+void	grep_free(t_grep *g)
+{
+	free(g->text);
+	free(g->ac.next);
+	if (g->dfa)
+	{
+		free(g->dfa->next);
+		free(g->dfa->sets);
+		free(g->dfa->slots);
+	}
+	free(g->dfa);
+	free(g->replay);
+	free(g->hout);
+	g->text = NULL;
+	g->replay = NULL;
+	g->hout = NULL;
+	g->ac.next = NULL;
+	g->dfa = NULL;
+}
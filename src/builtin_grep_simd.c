@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_grep_simd.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:48:20 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/17 23:54:18 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+#if defined(__x86_64__)
+# include <immintrin.h>
+
+/**
+ * @brief Marks the 16 positions of p where the pattern's first and last
+ * bytes both match.
+ *
+ * @param g The grep state.
+ * @param p At least plen + 15 readable bytes.
+ * @return One bit per candidate position.
+ */
+static uint32_t	grep_mask_sse2(const t_grep *g, const unsigned char *p)
+{
+	__m128i	a;
+	__m128i	b;
+
+	a = _mm_loadu_si128((const __m128i *)p);
+	b = _mm_loadu_si128((const __m128i *)(p + g->plen - 1));
+	a = _mm_or_si128(_mm_cmpeq_epi8(a, _mm_set1_epi8(g->first[0])),
+			_mm_cmpeq_epi8(a, _mm_set1_epi8(g->first[1])));
+	b = _mm_or_si128(_mm_cmpeq_epi8(b, _mm_set1_epi8(g->last[0])),
+			_mm_cmpeq_epi8(b, _mm_set1_epi8(g->last[1])));
+	return (_mm_movemask_epi8(_mm_and_si128(a, b)));
+}
+
+/**
+ * @brief Finds the pattern 16 positions at a time with SSE2.
+ *
+ * @param g The grep state.
+ * @param buf The bytes.
+ * @param len Length of buf.
+ * @return The offset of the match, or len if none.
+ */
+static size_t	grep_find_sse2(const t_grep *g, const unsigned char *buf,
+	size_t len)
+{
+	uint32_t	mask;
+	size_t		i;
+
+	i = 0;
+	while (i + g->plen + 15 <= len)
+	{
+		mask = grep_mask_sse2(g, buf + i);
+		while (mask)
+		{
+			if (grep_verify(g, buf + i + __builtin_ctz(mask)))
+				return (i + __builtin_ctz(mask));
+			mask &= mask - 1;
+		}
+		i += 16;
+	}
+	return (i + grep_scan(g, buf + i, len - i));
+}
+
+/**
+ * @brief Marks the 32 positions of p where the pattern's first and last
+ * bytes both match.
+ *
+ * @param g The grep state.
+ * @param p At least plen + 31 readable bytes.
+ * @return One bit per candidate position.
+ */
+__attribute__((target("avx2")))
+static uint32_t	grep_mask_avx2(const t_grep *g, const unsigned char *p)
+{
+	__m256i	a;
+	__m256i	b;
+
+	a = _mm256_loadu_si256((const __m256i *)p);
+	b = _mm256_loadu_si256((const __m256i *)(p + g->plen - 1));
+	a = _mm256_or_si256(_mm256_cmpeq_epi8(a, _mm256_set1_epi8(g->first[0])),
+			_mm256_cmpeq_epi8(a, _mm256_set1_epi8(g->first[1])));
+	b = _mm256_or_si256(_mm256_cmpeq_epi8(b, _mm256_set1_epi8(g->last[0])),
+			_mm256_cmpeq_epi8(b, _mm256_set1_epi8(g->last[1])));
+	return (_mm256_movemask_epi8(_mm256_and_si256(a, b)));
+}
+
+/**
+ * @brief Finds the pattern 32 positions at a time with AVX2.
+ *
+ * @param g The grep state.
+ * @param buf The bytes.
+ * @param len Length of buf.
+ * @return The offset of the match, or len if none.
+ */
+__attribute__((target("avx2")))
+static size_t	grep_find_avx2(const t_grep *g, const unsigned char *buf,
+	size_t len)
+{
+	uint32_t	mask;
+	size_t		i;
+
+	i = 0;
+	while (i + g->plen + 31 <= len)
+	{
+		mask = grep_mask_avx2(g, buf + i);
+		while (mask)
+		{
+			if (grep_verify(g, buf + i + __builtin_ctz(mask)))
+				return (i + __builtin_ctz(mask));
+			mask &= mask - 1;
+		}
+		i += 32;
+	}
+	return (i + grep_scan(g, buf + i, len - i));
+}
+
+const t_grepops	*grep_kernel(void)
+{
+	static t_grepops	ops;
+
+	if (ops.find)
+		return (&ops);
+	ops.find = grep_find_sse2;
+	if (__builtin_cpu_supports("avx2"))
+		ops.find = grep_find_avx2;
+	return (&ops);
+}
+
+#else
+
+const t_grepops	*grep_kernel(void)
+{
+	return (NULL);
+}
+
+#endif
@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_head.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:27:46 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 00:38:34 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+int	bi_count_parse(char **argv, t_bargs *args)
+{
+	const char	*num;
+	int			i;
+
+	args->mode = BI_LINES;
+	args->count = 10;
+	i = 1;
+	while (argv[i])
+	{
+		if (argv[i][0] != '-' || !argv[i][1])
+			return (1);
+		num = argv[i] + 1;
+		if (argv[i][1] == 'n' || argv[i][1] == 'c')
+		{
+			args->mode = BI_LINES;
+			if (argv[i][1] == 'c')
+				args->mode = BI_BYTES;
+			num = argv[i] + 2;
+			if (!*num)
+				num = argv[++i];
+		}
+		if (bi_number(num, &args->count))
+			return (1);
+		i++;
+	}
+	return (0);
+}
+
+size_t	head_take(t_bargs *args, const char *buf, size_t len)
+{
+	const char	*p;
+
+	if (args->mode == BI_BYTES)
+	{
+		if ((long long)len > args->count)
+			len = args->count;
+		args->count -= len;
+		return (len);
+	}
+	p = buf;
+	while (args->count > 0)
+	{
+		p = memchr(p, '\n', buf + len - p);
+		if (!p)
+			return (len);
+		p++;
+		args->count--;
+	}
+	return (p - buf);
+}
+
+int	bi_head(t_bargs *args)
+{
+	char	buf[BI_BUF];
+	ssize_t	bytes;
+	size_t	take;
+
+	bytes = 1;
+	while (args->count > 0 && bytes > 0)
+	{
+		bytes = bi_read(STDIN_FILENO, buf, sizeof(buf));
+		if (bytes <= 0)
+			break ;
+		take = head_take(args, buf, bytes);
+		if (bi_write(buf, take) < 0)
+			return (bi_fail("head", "error writing 'standard output'"));
+	}
+	if (bytes < 0)
+		return (bi_fail("head", "error reading 'standard input'"));
+	return (0);
+}
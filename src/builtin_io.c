@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_io.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:27:46 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/17 23:54:18 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+ssize_t	bi_read(int fd, char *buf, size_t len)
+{
+	ssize_t	bytes;
+
+	bytes = read(fd, buf, len);
+	while (bytes < 0 && errno == EINTR)
+		bytes = read(fd, buf, len);
+	return (bytes);
+}
+
+int	bi_write(const char *buf, size_t len)
+{
+	ssize_t	written;
+
+	while (len > 0)
+	{
+		written = write(STDOUT_FILENO, buf, len);
+		if (written < 0 && errno == EINTR)
+			continue ;
+		if (written < 0)
+			return (-1);
+		buf += written;
+		len -= written;
+	}
+	return (0);
+}
+
+int	bi_fail(const char *name, const char *what)
+{
+	char	line[PATH_MAX + 128];
+	int		len;
+
+	if (what)
+		len = snprintf(line, sizeof(line), "%s: %s: %s\n", name, what,
+				strerror(errno));
+	else
+		len = snprintf(line, sizeof(line), "%s: %s\n", name,
+				strerror(errno));
+	if (len > (int) sizeof(line) - 1)
+		len = sizeof(line) - 1;
+	if (len > 0)
+		write(STDERR_FILENO, line, len);
+	return (1);
+}
+
+int	bi_number(const char *str, long long *out)
+{
+	long long	n;
+
+	if (!str || !*str)
+		return (1);
+	n = 0;
+	while (*str >= '0' && *str <= '9')
+	{
+		if (n > (LLONG_MAX - (*str - '0')) / 10)
+			return (1);
+		n = n * 10 + (*str++ - '0');
+	}
+	if (*str)
+		return (1);
+	*out = n;
+	return (0);
+}
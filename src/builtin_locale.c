@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_locale.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:46:11 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 00:38:34 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+const char	*bi_locale(const char *category)
+{
+	const char	*vars[3];
+	char		*value;
+	int			i;
+
+	vars[0] = "LC_ALL";
+	vars[1] = category;
+	vars[2] = "LANG";
+	i = 0;
+	while (i < 3)
+	{
+		value = getenv(vars[i++]);
+		if (value && *value)
+			return (value);
+	}
+	return (NULL);
+}
+
+int	bi_c_locale(void)
+{
+	const char	*value;
+
+	value = bi_locale("LC_CTYPE");
+	return (!value || !ft_strncmp(value, "C", 2)
+		|| !ft_strncmp(value, "POSIX", 6));
+}
+
+int	bi_utf8_locale(void)
+{
+	const char	*value;
+
+	value = bi_locale("LC_CTYPE");
+	return (value && (ft_strnstr(value, "UTF-8", ft_strlen(value))
+			|| ft_strnstr(value, "utf8", ft_strlen(value))));
+}
+
+/**
+ * @brief Returns the length of the UTF-8 sequence at s, as glibc decodes.
+ *
+ * Overlong forms and surrogates are rejected; 5- and 6-byte forms are
+ * accepted, as glibc's mbrlen does.
+ *
+ * @param s The bytes, starting with a byte above 0x7f.
+ * @param n Bytes available.
+ * @return The sequence length, or 0 for an encoding error.
+ */
+static size_t	utf8_seq(const unsigned char *s, size_t n)
+{
+	size_t	len;
+	size_t	i;
+
+	if (s[0] < 0xc2 || s[0] > 0xfd)
+		return (0);
+	len = 2 + (s[0] >= 0xe0) + (s[0] >= 0xf0) + (s[0] >= 0xf8)
+		+ (s[0] >= 0xfc);
+	if (len > n)
+		return (0);
+	i = 1;
+	while (i < len)
+		if ((s[i++] & 0xc0) != 0x80)
+			return (0);
+	if (len > 2 && s[0] == (unsigned char)(0xff << (8 - len))
+		&& s[1] < (0x80 | (0x40 >> (len - 2))))
+		return (0);
+	if (s[0] == 0xed && s[1] >= 0xa0)
+		return (0);
+	return (len);
+}
+
+int	bi_utf8_valid(const char *str, size_t len)
+{
+	const unsigned char	*s;
+	size_t				i;
+	size_t				seq;
+
+	s = (const unsigned char *)str;
+	i = 0;
+	while (i < len)
+	{
+		if (s[i] < 0x80)
+		{
+			i++;
+			continue ;
+		}
+		seq = utf8_seq(s + i, len - i);
+		if (!seq)
+			return (0);
+		i += seq;
+	}
+	return (1);
+}
@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_sort.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:38:33 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 00:38:33 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+int	bi_sort_parse(char **argv, t_bargs *args)
+{
+	int	i;
+	int	j;
+
+	args->mode = 0;
+	i = 0;
+	while (argv[++i])
+	{
+		if (argv[i][0] != '-' || !argv[i][1])
+			return (1);
+		j = 0;
+		while (argv[i][++j])
+		{
+			if (argv[i][j] == 'n')
+				args->mode |= SORT_NUM;
+			else if (argv[i][j] == 'r')
+				args->mode |= SORT_REV;
+			else
+				return (1);
+		}
+	}
+	return (0);
+}
+
+
+/**
+ * @brief Moves heap[i] down while a child sorts after it.
+ *
+ * @param t The heap.
+ * @param i The slot.
+ * @param n Number of slots in the heap.
+ */
+static void	topk_down(t_topk *t, size_t i, size_t n)
+{
+	t_sline	tmp;
+	size_t	big;
+
+	while (2 * i + 1 < n)
+	{
+		big = 2 * i + 1;
+		if (big + 1 < n
+			&& sort_cmp(t->mode, &t->heap[big], &t->heap[big + 1]) < 0)
+			big++;
+		if (sort_cmp(t->mode, &t->heap[i], &t->heap[big]) >= 0)
+			return ;
+		tmp = t->heap[i];
+		t->heap[i] = t->heap[big];
+		t->heap[big] = tmp;
+		i = big;
+	}
+}
+
+/**
+ * @brief Copies a line the heap keeps, first making room for it while
+ * the heap holds fewer than k lines.
+ *
+ * The heap doubles up to k slots, so a large k costs nothing until
+ * that many lines arrive.
+ *
+ * @param t The heap.
+ * @param s The line, NUL-terminated.
+ * @param len Its length.
+ * @return The copy, or NULL on allocation failure.
+ */
+static unsigned char	*topk_copy(t_topk *t, const unsigned char *s,
+	size_t len)
+{
+	t_sline			*grown;
+	unsigned char	*copy;
+
+	if (t->n == t->cap && (long long)t->n < t->k)
+	{
+		t->cap = t->cap * 2 + 16;
+		if ((long long)t->cap > t->k)
+			t->cap = t->k;
+		grown = malloc(sizeof(t_sline) * t->cap);
+		if (!grown)
+			return (NULL);
+		ft_memcpy(grown, t->heap, sizeof(t_sline) * t->n);
+		free(t->heap);
+		t->heap = grown;
+	}
+	copy = malloc(len + 1);
+	if (copy)
+		ft_memcpy(copy, s, len + 1);
+	return (copy);
+}
+
+int	topk_push(t_topk *t, unsigned char *s, size_t len)
+{
+	t_sline	line;
+	size_t	i;
+
+	line.s = s;
+	line.len = len;
+	if ((long long)t->n >= t->k && (!t->n
+			|| sort_cmp(t->mode, &line, &t->heap[0]) >= 0))
+		return (0);
+	line.s = topk_copy(t, s, len);
+	if (!line.s)
+		return (-1);
+	if ((long long)t->n == t->k)
+	{
+		free(t->heap[0].s);
+		t->heap[0] = line;
+		topk_down(t, 0, t->n);
+		return (0);
+	}
+	t->heap[t->n++] = line;
+	i = t->n / 2;
+	while ((long long)t->n == t->k && i-- > 0)
+		topk_down(t, i, t->n);
+	return (0);
+}
+
+void	topk_order(t_topk *t)
+{
+	t_sline	tmp;
+	size_t	n;
+
+	n = t->n / 2;
+	while (n-- > 0)
+		topk_down(t, n, t->n);
+	n = t->n;
+	while (n > 1)
+	{
+		n--;
+		tmp = t->heap[0];
+		t->heap[0] = t->heap[n];
+		t->heap[n] = tmp;
+		topk_down(t, 0, n);
+	}
+}
@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_sort_cmp.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:38:33 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 00:38:33 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Checks whether a number, past its sign, is zero.
+ *
+ * @param s The digits.
+ * @return 1 for zero or no digits at all, 0 otherwise.
+ */
+static int	num_zero(const unsigned char *s)
+{
+	while (*s == '0')
+		s++;
+	if (*s == '.')
+	{
+		s++;
+		while (*s == '0')
+			s++;
+	}
+	return (!ft_isdigit(*s));
+}
+
+/**
+ * @brief Compares two fractions digit by digit; a missing digit counts
+ * as 0.
+ *
+ * @param a After the integer digits of the first number.
+ * @param b After the integer digits of the second number.
+ * @return Negative, 0 or positive.
+ */
+static int	num_frac(const unsigned char *a, const unsigned char *b)
+{
+	unsigned char	ca;
+	unsigned char	cb;
+
+	a += (*a == '.');
+	b += (*b == '.');
+	while (ft_isdigit(*a) || ft_isdigit(*b))
+	{
+		ca = '0';
+		if (ft_isdigit(*a))
+			ca = *a++;
+		cb = '0';
+		if (ft_isdigit(*b))
+			cb = *b++;
+		if (ca != cb)
+			return (ca - cb);
+	}
+	return (0);
+}
+
+/**
+ * @brief Compares two unsigned numbers: the one with more significant
+ * integer digits is larger, then the digits decide.
+ *
+ * @param a The first number.
+ * @param b The second number.
+ * @return Negative, 0 or positive.
+ */
+static int	num_mag(const unsigned char *a, const unsigned char *b)
+{
+	size_t	la;
+	size_t	lb;
+	int		diff;
+
+	while (*a == '0')
+		a++;
+	while (*b == '0')
+		b++;
+	la = 0;
+	while (ft_isdigit(a[la]))
+		la++;
+	lb = 0;
+	while (ft_isdigit(b[lb]))
+		lb++;
+	if (la != lb)
+		return ((la > lb) - (la < lb));
+	diff = memcmp(a, b, la);
+	if (diff)
+		return (diff);
+	return (num_frac(a + la, b + lb));
+}
+
+/**
+ * @brief Compares the leading numbers of two lines, as sort -n.
+ *
+ * Leading blanks are skipped, a line without a number counts as 0 and
+ * -0 equals 0.
+ *
+ * @param a The first line.
+ * @param b The second line.
+ * @return Negative, 0 or positive.
+ */
+static int	sort_num(const unsigned char *a, const unsigned char *b)
+{
+	int	sa;
+	int	sb;
+
+	while (*a == ' ' || *a == '\t')
+		a++;
+	while (*b == ' ' || *b == '\t')
+		b++;
+	sa = 1 - 2 * (*a == '-');
+	sb = 1 - 2 * (*b == '-');
+	a += (sa < 0);
+	b += (sb < 0);
+	if (num_zero(a))
+		sa = 0;
+	if (num_zero(b))
+		sb = 0;
+	if (sa != sb)
+		return ((sa > sb) - (sa < sb));
+	return (sa * num_mag(a, b));
+}
+
+int	sort_cmp(int mode, const t_sline *a, const t_sline *b)
+{
+	size_t	len;
+	int		diff;
+
+	diff = 0;
+	if (mode & SORT_NUM)
+		diff = sort_num(a->s, b->s);
+	if (!diff)
+	{
+		len = a->len;
+		if (b->len < len)
+			len = b->len;
+		diff = memcmp(a->s, b->s, len);
+		if (!diff)
+			diff = (a->len > b->len) - (a->len < b->len);
+	}
+	if (mode & SORT_REV)
+		diff = -diff;
+	return (diff);
+}
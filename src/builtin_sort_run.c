@@ -0,0 +1,167 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_sort_run.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:38:33 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 00:38:33 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Doubles the read buffer, for a line longer than it.
+ *
+ * @param buf The buffer, of cap bytes plus one; replaced.
+ * @param cap Its capacity; doubled.
+ * @param len Bytes in use.
+ * @return 0 on success, -1 on allocation failure.
+ */
+static int	topk_widen(unsigned char **buf, size_t *cap, size_t len)
+{
+	unsigned char	*grown;
+
+	grown = malloc(*cap * 2 + 1);
+	if (!grown)
+		return (-1);
+	ft_memcpy(grown, *buf, len);
+	free(*buf);
+	*buf = grown;
+	*cap *= 2;
+	return (0);
+}
+
+/**
+ * @brief Offers every complete line of buf to the heap.
+ *
+ * @param t The heap.
+ * @param buf The bytes, with room for one more past len.
+ * @param len Length of buf.
+ * @param done Receives how many bytes were consumed; at end of input
+ * the last line counts even without its newline.
+ * @return 0 on success, -1 on allocation failure.
+ */
+static int	topk_lines(t_topk *t, unsigned char *buf, size_t len,
+	size_t *done)
+{
+	unsigned char	*nl;
+	int				eof;
+
+	eof = (*done == 1);
+	*done = 0;
+	while (*done < len)
+	{
+		nl = memchr(buf + *done, '\n', len - *done);
+		if (!nl && !eof)
+			break ;
+		if (!nl)
+			nl = buf + len;
+		*nl = '\0';
+		if (topk_push(t, buf + *done, nl - (buf + *done)) < 0)
+			return (-1);
+		*done = nl - buf + 1;
+	}
+	if (*done > len)
+		*done = len;
+	return (0);
+}
+
+/**
+ * @brief Reads stdin to the end, keeping the lines the heap wants.
+ *
+ * Only the partial last line stays in buf between reads; buf doubles
+ * when a single line fills it.
+ *
+ * @param t The heap.
+ * @param buf The read buffer, of cap bytes plus one; may be replaced.
+ * @param cap Capacity of buf.
+ * @return 0 on success, -1 on a read error, -2 on allocation failure.
+ */
+static int	topk_read(t_topk *t, unsigned char **buf, size_t cap)
+{
+	ssize_t	bytes;
+	size_t	len;
+	size_t	done;
+
+	len = 0;
+	bytes = 1;
+	while (bytes > 0)
+	{
+		if (len == cap && topk_widen(buf, &cap, len) < 0)
+			return (-2);
+		bytes = bi_read(STDIN_FILENO, (char *)*buf + len, cap - len);
+		len += bytes * (bytes > 0);
+		done = (bytes == 0);
+		if (topk_lines(t, *buf, len, &done) < 0)
+			return (-2);
+		ft_memmove(*buf, *buf + done, len - done);
+		len -= done;
+	}
+	return (-(bytes < 0));
+}
+
+/**
+ * @brief Writes the kept lines in order, each with its newline.
+ *
+ * @param t The heap, with topk_order done.
+ * @return 0 on success, -1 on a write error.
+ */
+static int	topk_emit(t_topk *t)
+{
+	char	buf[BI_BUF];
+	size_t	used;
+	size_t	i;
+	t_sline	*line;
+
+	used = 0;
+	i = 0;
+	while (i < t->n)
+	{
+		line = &t->heap[i++];
+		line->s[line->len] = '\n';
+		if (used + line->len + 1 > sizeof(buf) && bi_write(buf, used) < 0)
+			return (-1);
+		if (used + line->len + 1 > sizeof(buf))
+			used = 0;
+		if (line->len + 1 > sizeof(buf)
+			&& bi_write((char *)line->s, line->len + 1) < 0)
+			return (-1);
+		if (line->len + 1 > sizeof(buf))
+			continue ;
+		ft_memcpy(buf + used, line->s, line->len + 1);
+		used += line->len + 1;
+	}
+	return (bi_write(buf, used));
+}
+
+int	bi_topk(t_bargs *sort, long long k)
+{
+	t_topk			t;
+	unsigned char	*buf;
+	int				status;
+
+	ft_bzero(&t, sizeof(t));
+	t.k = k;
+	t.mode = sort->mode;
+	buf = malloc(BI_BUF + 1);
+	status = -2;
+	if (buf)
+		status = topk_read(&t, &buf, BI_BUF);
+	free(buf);
+	topk_order(&t);
+	if (status == 0 && topk_emit(&t) < 0)
+		status = -3;
+	while (t.n > 0)
+		free(t.heap[--t.n].s);
+	free(t.heap);
+	if (status == -1)
+		return (bi_fail("sort", "read failed"));
+	if (status == -2)
+		return (bi_fail("sort", NULL));
+	if (status == -3)
+		return (bi_fail("sort", "write failed"));
+	return (0);
+}
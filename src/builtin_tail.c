@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_tail.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:27:46 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:27:48 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Finds where the last count lines or bytes of buf start.
+ *
+ * A final line without a newline still counts as a line.
+ *
+ * @param args Parsed arguments.
+ * @param buf The buffered input.
+ * @param len Buffered length.
+ * @return Offset of the first byte tail prints.
+ */
+static size_t	tail_start(t_bargs *args, const char *buf, size_t len)
+{
+	const char	*nl;
+	size_t		pos;
+	long long	left;
+
+	if (args->mode == BI_BYTES && (long long)len <= args->count)
+		return (0);
+	if (args->mode == BI_BYTES)
+		return (len - args->count);
+	if (args->count == 0)
+		return (len);
+	pos = len;
+	if (len && buf[len - 1] == '\n')
+		pos--;
+	left = args->count;
+	while (pos > 0)
+	{
+		nl = memrchr(buf, '\n', pos);
+		if (!nl)
+			return (0);
+		if (--left == 0)
+			return (nl - buf + 1);
+		pos = nl - buf;
+	}
+	return (0);
+}
+
+/**
+ * @brief Makes room for one more read, dropping what tail never prints.
+ *
+ * The kept tail is only recomputed once the buffer has doubled since
+ * the last time, so long windows do not cost a rescan per read.
+ *
+ * @param t Tail buffer.
+ * @param args Parsed arguments.
+ * @return 0 on success, -1 on allocation failure.
+ */
+static int	tail_reserve(t_tailbuf *t, t_bargs *args)
+{
+	size_t	start;
+	char	*grown;
+
+	if (t->len >= t->next_trim)
+	{
+		start = tail_start(args, t->buf, t->len);
+		ft_memmove(t->buf, t->buf + start, t->len - start);
+		t->len -= start;
+		t->next_trim = t->len * 2;
+		if (t->next_trim < TAIL_TRIM)
+			t->next_trim = TAIL_TRIM;
+	}
+	if (t->cap - t->len >= BI_BUF)
+		return (0);
+	grown = malloc(t->cap * 2 + BI_BUF);
+	if (!grown)
+		return (-1);
+	ft_memcpy(grown, t->buf, t->len);
+	free(t->buf);
+	t->buf = grown;
+	t->cap = t->cap * 2 + BI_BUF;
+	return (0);
+}
+
+int	bi_tail(t_bargs *args)
+{
+	t_tailbuf	t;
+	ssize_t		bytes;
+	size_t		start;
+
+	ft_bzero(&t, sizeof(t));
+	t.next_trim = TAIL_TRIM;
+	bytes = 1;
+	while (bytes > 0)
+	{
+		if (tail_reserve(&t, args) < 0)
+			return (bi_fail("tail", NULL));
+		bytes = bi_read(STDIN_FILENO, t.buf + t.len, t.cap - t.len);
+		if (bytes > 0)
+			t.len += bytes;
+	}
+	if (bytes < 0)
+		return (bi_fail("tail", "error reading 'standard input'"));
+	start = tail_start(args, t.buf, t.len);
+	if (bi_write(t.buf + start, t.len - start) < 0)
+		return (bi_fail("tail", "error writing 'standard output'"));
+	free(t.buf);
+	return (0);
+}
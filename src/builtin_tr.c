@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_tr.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:27:46 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/17 23:41:42 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Parses the -d and -s flags and checks the number of sets.
+ *
+ * @param argv The stage's argv.
+ * @param args Receives the TR_* flags in mode.
+ * @param first Receives the index of SET1 in argv.
+ * @return 0 on success, 1 for usage left to the real tr.
+ */
+static int	tr_flags(char **argv, t_bargs *args, int *first)
+{
+	const char	*flag;
+	int			i;
+
+	args->mode = 0;
+	i = 1;
+	while (argv[i] && argv[i][0] == '-' && argv[i][1])
+	{
+		flag = argv[i++];
+		while (*++flag)
+		{
+			if (*flag == 'd')
+				args->mode |= TR_DELETE;
+			else if (*flag == 's')
+				args->mode |= TR_SQUEEZE;
+			else
+				return (1);
+		}
+	}
+	*first = i;
+	while (argv[i])
+		if (argv[i++][0] == '-')
+			return (1);
+	if (args->mode == TR_SQUEEZE)
+		return (i - *first < 1 || i - *first > 2);
+	return (i - *first != 2 - (args->mode == TR_DELETE));
+}
+
+/**
+ * @brief Checks the classes of SET2 when translating.
+ *
+ * GNU tr only takes [:upper:] or [:lower:] there, aligned with the
+ * opposite class in SET1; only the whole-set form is handled here.
+ *
+ * @param set1 Argument SET1.
+ * @param set2 Argument SET2.
+ * @return 0 if SET2 has no class or is a case conversion, 1 otherwise.
+ */
+static int	tr_case_pair(const char *set1, const char *set2)
+{
+	if (!ft_strnstr(set2, "[:", ft_strlen(set2)))
+		return (0);
+	if (!ft_strncmp(set1, "[:lower:]", 10)
+		&& !ft_strncmp(set2, "[:upper:]", 10))
+		return (0);
+	return (ft_strncmp(set1, "[:upper:]", 10)
+		|| ft_strncmp(set2, "[:lower:]", 10));
+}
+
+/**
+ * @brief Builds the translation map of "tr SET1 SET2".
+ *
+ * A shorter SET2 is padded with its last character, as GNU tr does.
+ *
+ * @param args Parsed arguments.
+ * @param set1 Argument SET1.
+ * @param set2 Argument SET2.
+ * @return 0 on success, 1 for syntax left to the real tr.
+ */
+static int	tr_build_map(t_bargs *args, const char *set1, const char *set2)
+{
+	unsigned char	from[TR_SET_MAX];
+	unsigned char	to[TR_SET_MAX];
+	int				len1;
+	int				len2;
+	int				i;
+
+	if (tr_case_pair(set1, set2) || tr_expand(set1, from, &len1)
+		|| tr_expand(set2, to, &len2) || len2 == 0)
+		return (1);
+	i = 0;
+	while (i < len1)
+	{
+		if (i < len2)
+			args->map[from[i]] = to[i];
+		else
+			args->map[from[i]] = to[len2 - 1];
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Marks every character of a set in a membership table.
+ *
+ * @param table The table, indexed by byte.
+ * @param set The set as written.
+ * @return 0 on success, 1 for syntax left to the real tr.
+ */
+static int	tr_fill(unsigned char *table, const char *set)
+{
+	unsigned char	chars[TR_SET_MAX];
+	int				len;
+
+	if (tr_expand(set, chars, &len))
+		return (1);
+	while (len > 0)
+		table[chars[--len]] = 1;
+	return (0);
+}
+
+int	bi_tr_parse(char **argv, t_bargs *args)
+{
+	int	first;
+	int	i;
+
+	if (tr_flags(argv, args, &first))
+		return (1);
+	i = -1;
+	while (++i < 256)
+	{
+		args->map[i] = i;
+		args->del[i] = 0;
+		args->sq[i] = 0;
+	}
+	if (!(args->mode & TR_DELETE) && argv[first + 1]
+		&& tr_build_map(args, argv[first], argv[first + 1]))
+		return (1);
+	if ((args->mode & TR_DELETE) && tr_fill(args->del, argv[first]))
+		return (1);
+	if (!(args->mode & TR_SQUEEZE))
+		return (0);
+	if (argv[first + 1])
+		return (tr_fill(args->sq, argv[first + 1]));
+	return (tr_fill(args->sq, argv[first]));
+}
@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_tr_avx2.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:40:00 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/17 23:40:00 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+#if defined(__x86_64__)
+# include <immintrin.h>
+
+/**
+ * @brief Marks the bytes of v that belong to set, as tr_member_ssse3.
+ *
+ * @param set The set.
+ * @param v 32 bytes.
+ * @return Non-zero bytes where v holds a member.
+ */
+__attribute__((target("avx2")))
+static __m256i	tr_member_avx2(const t_trset *set, __m256i v)
+{
+	__m256i	nib;
+	__m256i	row;
+
+	nib = _mm256_and_si256(v, _mm256_set1_epi8(0x0f));
+	row = _mm256_blendv_epi8(
+			_mm256_shuffle_epi8(_mm256_broadcastsi128_si256(
+					_mm_loadu_si128((const __m128i *)set->bits)), nib),
+			_mm256_shuffle_epi8(_mm256_broadcastsi128_si256(
+					_mm_loadu_si128((const __m128i *)(set->bits + 16))), nib),
+			v);
+	nib = _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0f));
+	return (_mm256_and_si256(row, _mm256_shuffle_epi8(
+				_mm256_set1_epi64x(0x8040201008040201LL), nib)));
+}
+
+/**
+ * @brief Translates 32 bytes at a time with one vpshufb per changed row.
+ *
+ * @param args Parsed arguments.
+ * @param buf The bytes, translated in place.
+ * @param len Length of buf.
+ * @return The number of bytes translated.
+ */
+__attribute__((target("avx2")))
+static size_t	tr_map_avx2(const t_bargs *args, unsigned char *buf,
+	size_t len)
+{
+	__m256i	v;
+	__m256i	lo;
+	__m256i	hi;
+	size_t	i;
+	int		r;
+
+	i = 0;
+	while (i + 32 <= len)
+	{
+		v = _mm256_loadu_si256((const __m256i *)(buf + i));
+		lo = _mm256_and_si256(v, _mm256_set1_epi8(0x0f));
+		hi = _mm256_and_si256(_mm256_srli_epi16(v, 4),
+				_mm256_set1_epi8(0x0f));
+		r = -1;
+		while (++r < args->plan.nrows)
+			v = _mm256_blendv_epi8(v, _mm256_shuffle_epi8(
+						_mm256_broadcastsi128_si256(_mm_loadu_si128(
+								(const __m128i *)(args->map
+									+ args->plan.rows[r] * 16))), lo),
+					_mm256_cmpeq_epi8(hi,
+						_mm256_set1_epi8(args->plan.rows[r])));
+		_mm256_storeu_si256((__m256i *)(buf + i), v);
+		i += 32;
+	}
+	return (i);
+}
+
+/**
+ * @brief Copies 32-byte blocks until one holds a member of the set.
+ *
+ * @param set The set.
+ * @param dst Where to copy.
+ * @param src The bytes.
+ * @param len Length of src.
+ * @return The number of bytes copied.
+ */
+__attribute__((target("avx2")))
+static size_t	tr_keep_avx2(const t_trset *set, unsigned char *dst,
+	const unsigned char *src, size_t len)
+{
+	__m256i	v;
+	__m256i	hit;
+	size_t	i;
+
+	i = 0;
+	while (i + 32 <= len)
+	{
+		v = _mm256_loadu_si256((const __m256i *)(src + i));
+		hit = tr_member_avx2(set, v);
+		if (set->runs)
+			hit = _mm256_and_si256(hit, _mm256_cmpeq_epi8(v,
+						_mm256_loadu_si256((const __m256i *)(src + i - 1))));
+		if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(hit,
+					_mm256_setzero_si256())) != -1)
+			break ;
+		_mm256_storeu_si256((__m256i *)(dst + i), v);
+		i += 32;
+	}
+	return (i);
+}
+
+void	tr_kernel_avx2(t_trops *ops)
+{
+	ops->map = tr_map_avx2;
+	ops->keep = tr_keep_avx2;
+}
+
+#endif
@@ -0,0 +1,153 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_tr_run.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:37:16 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 00:38:34 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+void	tr_plan(t_bargs *args)
+{
+	t_trplan	*plan;
+	int			c;
+
+	plan = &args->plan;
+	ft_bzero(plan, sizeof(*plan));
+	plan->sq.runs = 1;
+	plan->last = -1;
+	c = -1;
+	while (++c < 256)
+	{
+		if (args->map[c] != c
+			&& (!plan->nrows || plan->rows[plan->nrows - 1] != c >> 4))
+			plan->rows[plan->nrows++] = c >> 4;
+		if (args->del[c])
+			plan->del.bits[(c >> 7) * 16 + (c & 15)] |= 1 << ((c >> 4) & 7);
+		if (args->sq[c])
+			plan->sq.bits[(c >> 7) * 16 + (c & 15)] |= 1 << ((c >> 4) & 7);
+	}
+}
+
+/**
+ * @brief Translates buf in place through the map, if it changes any byte.
+ *
+ * @param args Parsed arguments.
+ * @param ops The SIMD kernels, or NULL.
+ * @param buf The bytes.
+ * @param len Length of buf.
+ */
+static void	tr_map(const t_bargs *args, const t_trops *ops,
+	unsigned char *buf, size_t len)
+{
+	size_t	i;
+
+	if (!args->plan.nrows)
+		return ;
+	i = 0;
+	if (ops)
+		i = ops->map(args, buf, len);
+	while (i < len)
+	{
+		buf[i] = args->map[buf[i]];
+		i++;
+	}
+}
+
+/**
+ * @brief Removes the bytes of the -d set from buf.
+ *
+ * The kernel copies blocks without any such byte; the block holding
+ * the next one is compacted with the table.
+ *
+ * @param args Parsed arguments.
+ * @param ops The SIMD kernels, or NULL.
+ * @param buf The bytes.
+ * @param len Length of buf.
+ * @return The new length.
+ */
+static size_t	tr_delete(const t_bargs *args, const t_trops *ops,
+	unsigned char *buf, size_t len)
+{
+	size_t	out;
+	size_t	pos;
+	size_t	end;
+
+	out = 0;
+	pos = 0;
+	while (pos < len)
+	{
+		end = 0;
+		if (ops)
+			end = ops->keep(&args->plan.del, buf + out, buf + pos,
+					len - pos);
+		out += end;
+		pos += end;
+		end = 0;
+		while (pos < len && end++ < TR_BLOCK)
+		{
+			buf[out] = buf[pos];
+			out += !args->del[buf[pos++]];
+		}
+	}
+	return (out);
+}
+
+/**
+ * @brief Squeezes runs of a byte of the -s set into one.
+ *
+ * A byte is dropped when it repeats the byte before it in the input,
+ * which is also the last byte written; plan.last carries it across
+ * reads.
+ *
+ * @param args Parsed arguments.
+ * @param ops The SIMD kernels, or NULL.
+ * @param buf The bytes.
+ * @param len Length of buf.
+ * @return The new length.
+ */
+static size_t	tr_squeeze(const t_bargs *args, const t_trops *ops,
+	unsigned char *buf, size_t len)
+{
+	size_t	out;
+	size_t	pos;
+	size_t	end;
+
+	out = (len && (!args->sq[buf[0]] || buf[0] != args->plan.last));
+	pos = 1;
+	while (pos < len)
+	{
+		end = 0;
+		if (ops)
+			end = ops->keep(&args->plan.sq, buf + out, buf + pos,
+					len - pos);
+		out += end;
+		pos += end;
+		end = 0;
+		while (pos < len && end++ < TR_BLOCK)
+		{
+			if (!args->sq[buf[pos]] || buf[pos] != buf[pos - 1])
+				buf[out++] = buf[pos];
+			pos++;
+		}
+	}
+	return (out);
+}
+
+size_t	tr_block(t_bargs *args, const t_trops *ops, unsigned char *buf,
+	size_t len)
+{
+	tr_map(args, ops, buf, len);
+	if (args->mode & TR_DELETE)
+		len = tr_delete(args, ops, buf, len);
+	if (args->mode & TR_SQUEEZE)
+		len = tr_squeeze(args, ops, buf, len);
+	if (len)
+		args->plan.last = buf[len - 1];
+	return (len);
+}
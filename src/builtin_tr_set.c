@@ -0,0 +1,145 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_tr_set.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:35:17 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 00:24:43 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Reads one character of a tr set, decoding backslash escapes.
+ *
+ * @param s Cursor in the set; advanced past the character.
+ * @param c Receives the character.
+ * @return 0 on success, 1 for syntax left to the real tr.
+ */
+static int	tr_char(const char **s, unsigned char *c)
+{
+	const char	*esc;
+	int			n;
+
+	if (**s == '[')
+		return (1);
+	esc = NULL;
+	if (**s == '\\' && (*s)[1])
+		esc = ft_strchr("\\abfnrtv", (*s)[1]);
+	if (**s != '\\' || esc)
+	{
+		*c = **s;
+		if (esc)
+			*c = "\\\a\b\f\n\r\t\v"[esc - "\\abfnrtv"];
+		*s += 1 + (esc != NULL);
+		return (0);
+	}
+	(*s)++;
+	n = 0;
+	*c = 0;
+	while (n < 3 && **s >= '0' && **s <= '7')
+	{
+		*c = *c * 8 + (*(*s)++ - '0');
+		n++;
+	}
+	return (n == 0);
+}
+
+t_ctype	bi_ctype(const char *name, size_t n)
+{
+	static const char	*names[] = {"alnum", "alpha", "blank", "cntrl",
+		"digit", "graph", "lower", "print", "punct", "space", "upper",
+		"xdigit", NULL};
+	static int			(*const is[])(int) = {isalnum, isalpha, isblank,
+		iscntrl, isdigit, isgraph, islower, isprint, ispunct, isspace,
+		isupper, isxdigit};
+	int					i;
+
+	i = 0;
+	while (names[i] && (ft_strncmp(names[i], name, n) || names[i][n]))
+		i++;
+	if (!names[i])
+		return (NULL);
+	return (is[i]);
+}
+
+/**
+ * @brief Expands a [:class:] construct at the start of s.
+ *
+ * Members are listed in byte order, so [:lower:] and [:upper:] line up
+ * for case conversion.
+ *
+ * @param s Cursor in the set; advanced past the construct.
+ * @param out Receives the class members.
+ * @param len Number of characters already in out; updated.
+ * @return 0 on success, 1 for syntax left to the real tr.
+ */
+static int	tr_class(const char **s, unsigned char *out, int *len)
+{
+	const char	*end;
+	t_ctype		is;
+	size_t		n;
+
+	end = ft_strchr((char *)*s + 2, ':');
+	if (!end || end[1] != ']' || end[2] == '-' || *len + 256 > TR_SET_MAX)
+		return (1);
+	is = bi_ctype(*s + 2, end - (*s + 2));
+	if (!is)
+		return (1);
+	*s = end + 2;
+	n = 0;
+	while (n < 256)
+		if (is(n++))
+			out[(*len)++] = n - 1;
+	return (0);
+}
+
+/**
+ * @brief Expands one character or a-z range at the start of s.
+ *
+ * @param s Cursor in the set; advanced past the range.
+ * @param out Receives the characters.
+ * @param len Number of characters already in out; updated.
+ * @return 0 on success, 1 for syntax left to the real tr.
+ */
+static int	tr_range(const char **s, unsigned char *out, int *len)
+{
+	unsigned char	lo;
+	unsigned char	hi;
+
+	if (tr_char(s, &lo))
+		return (1);
+	hi = lo;
+	if ((*s)[0] == '-' && (*s)[1])
+	{
+		(*s)++;
+		if (tr_char(s, &hi) || hi < lo)
+			return (1);
+	}
+	if (*len + (hi - lo) + 1 > TR_SET_MAX)
+		return (1);
+	while (lo < hi)
+		out[(*len)++] = lo++;
+	out[(*len)++] = hi;
+	return (0);
+}
+
+int	tr_expand(const char *s, unsigned char *out, int *len)
+{
+	*len = 0;
+	while (*s)
+	{
+		if (s[0] == '[' && s[1] == ':')
+		{
+			if ((!bi_c_locale() && !bi_utf8_locale())
+				|| tr_class(&s, out, len))
+				return (1);
+		}
+		else if (tr_range(&s, out, len))
+			return (1);
+	}
+	return (0);
+}
@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_tr_simd.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:37:16 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/17 23:37:16 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+#if defined(__x86_64__)
+# include <immintrin.h>
+
+/**
+ * @brief Marks the bytes of v that belong to set.
+ *
+ * pshufb on the low nibble fetches the bitmap entry of each byte and
+ * pshufb on the high nibble the bit to test in it.
+ *
+ * @param set The set.
+ * @param v 16 bytes.
+ * @return Non-zero bytes where v holds a member.
+ */
+__attribute__((target("ssse3")))
+static __m128i	tr_member_ssse3(const t_trset *set, __m128i v)
+{
+	__m128i	nib;
+	__m128i	sign;
+	__m128i	row;
+
+	nib = _mm_and_si128(v, _mm_set1_epi8(0x0f));
+	sign = _mm_cmplt_epi8(v, _mm_setzero_si128());
+	row = _mm_or_si128(_mm_andnot_si128(sign, _mm_shuffle_epi8(
+					_mm_loadu_si128((const __m128i *)set->bits), nib)),
+			_mm_and_si128(sign, _mm_shuffle_epi8(
+					_mm_loadu_si128((const __m128i *)(set->bits + 16)), nib)));
+	nib = _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0f));
+	return (_mm_and_si128(row, _mm_shuffle_epi8(
+				_mm_set1_epi64x(0x8040201008040201LL), nib)));
+}
+
+/**
+ * @brief Translates 16 bytes at a time with one pshufb per changed row.
+ *
+ * The low nibble indexes a 16-byte row of the map; the result is kept
+ * where the high nibble selects that row.
+ *
+ * @param args Parsed arguments.
+ * @param buf The bytes, translated in place.
+ * @param len Length of buf.
+ * @return The number of bytes translated.
+ */
+__attribute__((target("ssse3")))
+static size_t	tr_map_ssse3(const t_bargs *args, unsigned char *buf,
+	size_t len)
+{
+	__m128i	v;
+	__m128i	lo;
+	__m128i	hi;
+	__m128i	sel;
+	size_t	i;
+	int		r;
+
+	i = 0;
+	while (i + 16 <= len)
+	{
+		v = _mm_loadu_si128((const __m128i *)(buf + i));
+		lo = _mm_and_si128(v, _mm_set1_epi8(0x0f));
+		hi = _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0f));
+		r = -1;
+		while (++r < args->plan.nrows)
+		{
+			sel = _mm_cmpeq_epi8(hi, _mm_set1_epi8(args->plan.rows[r]));
+			v = _mm_or_si128(_mm_andnot_si128(sel, v), _mm_and_si128(sel,
+						_mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)
+								(args->map + args->plan.rows[r] * 16)), lo)));
+		}
+		_mm_storeu_si128((__m128i *)(buf + i), v);
+		i += 16;
+	}
+	return (i);
+}
+
+/**
+ * @brief Copies 16-byte blocks until one holds a member of the set.
+ *
+ * @param set The set.
+ * @param dst Where to copy.
+ * @param src The bytes.
+ * @param len Length of src.
+ * @return The number of bytes copied.
+ */
+__attribute__((target("ssse3")))
+static size_t	tr_keep_ssse3(const t_trset *set, unsigned char *dst,
+	const unsigned char *src, size_t len)
+{
+	__m128i	v;
+	__m128i	hit;
+	size_t	i;
+
+	i = 0;
+	while (i + 16 <= len)
+	{
+		v = _mm_loadu_si128((const __m128i *)(src + i));
+		hit = tr_member_ssse3(set, v);
+		if (set->runs)
+			hit = _mm_and_si128(hit, _mm_cmpeq_epi8(v,
+						_mm_loadu_si128((const __m128i *)(src + i - 1))));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(hit, _mm_setzero_si128()))
+			!= 0xffff)
+			break ;
+		_mm_storeu_si128((__m128i *)(dst + i), v);
+		i += 16;
+	}
+	return (i);
+}
+
+const t_trops	*tr_kernel(void)
+{
+	static t_trops	ops;
+
+	if (ops.map)
+		return (&ops);
+	if (__builtin_cpu_supports("avx2"))
+		tr_kernel_avx2(&ops);
+	else if (__builtin_cpu_supports("ssse3"))
+	{
+		ops.map = tr_map_ssse3;
+		ops.keep = tr_keep_ssse3;
+	}
+	else
+		return (NULL);
+	return (&ops);
+}
+
+#else
+
+const t_trops	*tr_kernel(void)
+{
+	return (NULL);
+}
+
+#endif
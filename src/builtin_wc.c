@@ -0,0 +1,152 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_wc.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:27:46 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/17 23:29:34 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+int	bi_wc_parse(char **argv, t_bargs *args)
+{
+	int	i;
+	int	j;
+
+	args->mode = 0;
+	i = 1;
+	while (argv[i])
+	{
+		if (argv[i][0] != '-' || !argv[i][1])
+			return (1);
+		j = 1;
+		while (argv[i][j] == 'l' || argv[i][j] == 'w' || argv[i][j] == 'c')
+		{
+			args->mode |= (argv[i][j] == 'l') * WC_LINES
+				| (argv[i][j] == 'w') * WC_WORDS
+				| (argv[i][j] == 'c') * WC_BYTES;
+			j++;
+		}
+		if (argv[i++][j])
+			return (1);
+	}
+	if (!args->mode)
+		args->mode = WC_LINES | WC_WORDS | WC_BYTES;
+	return ((args->mode & WC_WORDS) && !bi_c_locale());
+}
+
+/**
+ * @brief Computes the column width coreutils uses for stdin.
+ *
+ * A single count is not padded. Otherwise a regular file gets as many
+ * digits as its size and anything else a width of 7.
+ *
+ * @param mode The requested counts.
+ * @return The column width.
+ */
+static int	wc_width(int mode)
+{
+	struct stat	st;
+	long long	size;
+	int			width;
+
+	if (mode == WC_LINES || mode == WC_WORDS || mode == WC_BYTES
+		|| fstat(STDIN_FILENO, &st) < 0)
+		return (1);
+	if (!S_ISREG(st.st_mode))
+		return (7);
+	width = 1;
+	size = st.st_size;
+	while (size >= 10)
+	{
+		size /= 10;
+		width++;
+	}
+	return (width);
+}
+
+/**
+ * @brief Prints the selected counts in coreutils' order and format.
+ *
+ * @param wc The counts.
+ * @param mode The requested counts.
+ * @return 0 on success, 1 on a write error.
+ */
+static int	wc_print(t_wc *wc, int mode)
+{
+	char	line[96];
+	int		width;
+	int		len;
+
+	width = wc_width(mode);
+	len = 0;
+	if (mode & WC_LINES)
+		len += snprintf(line + len, sizeof(line) - len, "%*lld ", width,
+				wc->lines);
+	if (mode & WC_WORDS)
+		len += snprintf(line + len, sizeof(line) - len, "%*lld ", width,
+				wc->words);
+	if (mode & WC_BYTES)
+		len += snprintf(line + len, sizeof(line) - len, "%*lld ", width,
+				wc->bytes);
+	line[len - 1] = '\n';
+	if (bi_write(line, len) < 0)
+		return (bi_fail("wc", "write error"));
+	return (0);
+}
+
+/**
+ * @brief Counts a regular-file stdin through a read-only mapping.
+ *
+ * For -c alone the size comes from fstat, as coreutils does.
+ *
+ * @param wc Receives the counts.
+ * @param mode The requested counts.
+ * @return 1 if stdin was counted, 0 to fall back to read().
+ */
+static int	wc_mapped(t_wc *wc, int mode)
+{
+	struct stat	st;
+	void		*map;
+
+	if (lseek(STDIN_FILENO, 0, SEEK_CUR) != 0
+		|| fstat(STDIN_FILENO, &st) < 0 || !S_ISREG(st.st_mode)
+		|| st.st_size <= 0)
+		return (0);
+	if (mode == WC_BYTES)
+	{
+		wc->bytes = st.st_size;
+		return (1);
+	}
+	map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, STDIN_FILENO, 0);
+	if (map == MAP_FAILED)
+		return (0);
+	madvise(map, st.st_size, MADV_SEQUENTIAL | MADV_WILLNEED);
+	wc_count(wc, map, st.st_size, mode);
+	munmap(map, st.st_size);
+	return (1);
+}
+
+int	bi_wc(t_bargs *args)
+{
+	char	buf[BI_BUF];
+	t_wc	wc;
+	ssize_t	bytes;
+
+	ft_bzero(&wc, sizeof(wc));
+	if (wc_mapped(&wc, args->mode))
+		return (wc_print(&wc, args->mode));
+	bytes = bi_read(STDIN_FILENO, buf, sizeof(buf));
+	while (bytes > 0)
+	{
+		wc_count(&wc, (unsigned char *)buf, bytes, args->mode);
+		bytes = bi_read(STDIN_FILENO, buf, sizeof(buf));
+	}
+	if (bytes < 0)
+		return (bi_fail("wc", "standard input"));
+	return (wc_print(&wc, args->mode));
+}
@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_wc_count.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:29:34 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/17 23:29:34 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Counts a block one byte at a time.
+ *
+ * As in coreutils' C locale, a word is a run of printable bytes, and
+ * control bytes and bytes >= 0x80 neither start nor end a word.
+ *
+ * @param wc Running counts.
+ * @param buf The block.
+ * @param len Block length.
+ */
+static void	wc_scalar(t_wc *wc, const unsigned char *buf, size_t len)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < len)
+	{
+		if (buf[i] == '\n')
+			wc->lines++;
+		if (buf[i] == ' ' || (buf[i] >= '\t' && buf[i] <= '\r'))
+			wc->in_word = 0;
+		else if (buf[i] > ' ' && buf[i] < 0x7f && !wc->in_word)
+		{
+			wc->words++;
+			wc->in_word = 1;
+		}
+		i++;
+	}
+}
+
+/**
+ * @brief Adds the counts of 64 classified bytes.
+ *
+ * Bytes that are neither spaces nor printable keep the state of the
+ * byte before them. Adding "printable shifted by one" into the mask of
+ * such bytes carries through each run that follows a printable byte,
+ * which marks the whole run as inside a word. A word starts at every
+ * printable byte whose predecessor is not inside a word.
+ *
+ * @param wc Running counts.
+ * @param m The masks of the 64 bytes.
+ */
+static void	wc_bits(t_wc *wc, t_wcmask *m)
+{
+	uint64_t	other;
+	uint64_t	carry;
+	uint64_t	in_word;
+
+	wc->lines += __builtin_popcountll(m->nl);
+	other = ~(m->sp | m->pr);
+	carry = ((m->pr << 1) | (uint64_t)wc->in_word) & other;
+	in_word = m->pr | (((other + carry) ^ other) & other);
+	wc->words += __builtin_popcountll(m->pr
+			& ~((in_word << 1) | (uint64_t)wc->in_word));
+	wc->in_word = in_word >> 63;
+}
+
+void	wc_count(t_wc *wc, const unsigned char *buf, size_t len, int mode)
+{
+	const t_wcops	*ops;
+	t_wcmask		m;
+	size_t			i;
+
+	wc->bytes += len;
+	if (mode == WC_BYTES)
+		return ;
+	ops = wc_kernel();
+	i = 0;
+	if (ops && !(mode & WC_WORDS))
+	{
+		wc->lines += ops->lines(buf, len);
+		i = len - len % 64;
+	}
+	while (ops && i + 64 <= len)
+	{
+		ops->masks(buf + i, &m);
+		wc_bits(wc, &m);
+		i += 64;
+	}
+	wc_scalar(wc, buf + i, len - i);
+}
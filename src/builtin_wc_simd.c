@@ -0,0 +1,153 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_wc_simd.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:29:34 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/17 23:29:34 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+#if defined(__x86_64__)
+# include <immintrin.h>
+
+/**
+ * @brief Classifies 64 bytes with SSE2.
+ *
+ * @param p The bytes.
+ * @param m Receives one bit per byte: newline, space class, printable.
+ */
+static void	wc_masks_sse2(const unsigned char *p, t_wcmask *m)
+{
+	__m128i	v;
+	int		i;
+
+	*m = (t_wcmask){0, 0, 0};
+	i = 0;
+	while (i < 4)
+	{
+		v = _mm_loadu_si128((const __m128i *)(p + i * 16));
+		m->nl |= (uint64_t)(uint16_t)_mm_movemask_epi8(
+				_mm_cmpeq_epi8(v, _mm_set1_epi8('\n'))) << (i * 16);
+		m->sp |= (uint64_t)(uint16_t)_mm_movemask_epi8(_mm_or_si128(
+					_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')),
+					_mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('\t' - 1)),
+						_mm_cmplt_epi8(v, _mm_set1_epi8('\r' + 1)))))
+			<< (i * 16);
+		m->pr |= (uint64_t)(uint16_t)_mm_movemask_epi8(_mm_and_si128(
+					_mm_cmpgt_epi8(v, _mm_set1_epi8(' ')),
+					_mm_cmplt_epi8(v, _mm_set1_epi8(0x7f)))) << (i * 16);
+		i++;
+	}
+}
+
+/**
+ * @brief Classifies 64 bytes with AVX2.
+ *
+ * @param p The bytes.
+ * @param m Receives one bit per byte: newline, space class, printable.
+ */
+__attribute__((target("avx2,popcnt")))
+static void	wc_masks_avx2(const unsigned char *p, t_wcmask *m)
+{
+	__m256i	v;
+	int		i;
+
+	*m = (t_wcmask){0, 0, 0};
+	i = 0;
+	while (i < 2)
+	{
+		v = _mm256_loadu_si256((const __m256i *)(p + i * 32));
+		m->nl |= (uint64_t)(uint32_t)_mm256_movemask_epi8(
+				_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n'))) << (i * 32);
+		m->sp |= (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_or_si256(
+					_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')),
+					_mm256_and_si256(
+						_mm256_cmpgt_epi8(v, _mm256_set1_epi8('\t' - 1)),
+						_mm256_cmpgt_epi8(_mm256_set1_epi8('\r' + 1), v))))
+			<< (i * 32);
+		m->pr |= (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_and_si256(
+					_mm256_cmpgt_epi8(v, _mm256_set1_epi8(' ')),
+					_mm256_cmpgt_epi8(_mm256_set1_epi8(0x7f), v)))
+			<< (i * 32);
+		i++;
+	}
+}
+
+/**
+ * @brief Counts newlines in the full 64-byte blocks of buf with SSE2.
+ *
+ * @param p The bytes.
+ * @param len Length; a partial last block is left to the caller.
+ * @return The number of newlines.
+ */
+static size_t	wc_lines_sse2(const unsigned char *p, size_t len)
+{
+	size_t	lines;
+	size_t	i;
+
+	lines = 0;
+	i = 0;
+	while (i + 16 <= len - len % 64)
+	{
+		lines += __builtin_popcount(_mm_movemask_epi8(_mm_cmpeq_epi8(
+						_mm_loadu_si128((const __m128i *)(p + i)),
+						_mm_set1_epi8('\n'))));
+		i += 16;
+	}
+	return (lines);
+}
+
+/**
+ * @brief Counts newlines in the full 64-byte blocks of buf with AVX2.
+ *
+ * @param p The bytes.
+ * @param len Length; a partial last block is left to the caller.
+ * @return The number of newlines.
+ */
+__attribute__((target("avx2,popcnt")))
+static size_t	wc_lines_avx2(const unsigned char *p, size_t len)
+{
+	size_t	lines;
+	size_t	i;
+
+	lines = 0;
+	i = 0;
+	while (i + 32 <= len - len % 64)
+	{
+		lines += __builtin_popcount(_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+						_mm256_loadu_si256((const __m256i *)(p + i)),
+						_mm256_set1_epi8('\n'))));
+		i += 32;
+	}
+	return (lines);
+}
+
+const t_wcops	*wc_kernel(void)
+{
+	static t_wcops	ops;
+
+	if (ops.masks)
+		return (&ops);
+	ops.masks = wc_masks_sse2;
+	ops.lines = wc_lines_sse2;
+	if (__builtin_cpu_supports("avx2"))
+	{
+		ops.masks = wc_masks_avx2;
+		ops.lines = wc_lines_avx2;
+	}
+	return (&ops);
+}
+
+#else
+
+const t_wcops	*wc_kernel(void)
+{
+	return (NULL);
+}
+
+#endif
@@ -6,7 +6,7 @@
 /*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/10 13:15:26 by dancuenc          #+#    #+#             */
-/*   Updated: 2025/07/10 16:30:01 by dancuenc         ###   ########.fr       */
+/*   Updated: 2026/10/17 23:24:00 by dancuenc         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -21,51 +21,11 @@ void	safe_close(int *fd)
 	}
 }
 
-void	cleanup_heredoc(t_pipex *pipex)
+void	free_parsed(t_pipex *pipex)
 {
-	if (pipex->here_doc)
-		unlink(".heredoc_tmp");
-}
-
-void	free_cmd_paths(t_pipex *pipex)
-{
-	int	i;
-
-	if (!pipex->cmd_paths)
-		return ;
-	i = 0;
-	while (i < pipex->cmd_count)
-	{
-		free(pipex->cmd_paths[i]);
-		pipex->cmd_paths[i] = NULL;
-		i++;
-	}
-	free(pipex->cmd_paths);
+	arena_reset(&pipex->arena);
+	pipex->paths = NULL;
 	pipex->cmd_paths = NULL;
-}
-
-void	free_cmd_args(t_pipex *pipex)
-{
-	int	i;
-	int	j;
-
-	if (!pipex->cmd_args)
-		return ;
-	i = 0;
-	while (i < pipex->cmd_count && pipex->cmd_args[i])
-	{
-		j = 0;
-		while (pipex->cmd_args[i][j])
-		{
-			free(pipex->cmd_args[i][j]);
-			pipex->cmd_args[i][j] = NULL;
-			j++;
-		}
-		free(pipex->cmd_args[i]);
-		pipex->cmd_args[i] = NULL;
-		i++;
-	}
-	free(pipex->cmd_args);
 	pipex->cmd_args = NULL;
 }
 
@@ -75,12 +35,9 @@ void	parent_free(t_pipex *pipex)
 		return ;
 	safe_close(&pipex->in_fd);
 	safe_close(&pipex->out_fd);
-	cleanup_heredoc(pipex);
-	free_cmd_paths(pipex);
-	free_cmd_args(pipex);
-	if (pipex->pipes)
-	{
-		free(pipex->pipes);
-		pipex->pipes = NULL;
-	}
+	free_parsed(pipex);
+	close_pipes(pipex);
+	pidx_free(pipex);
+	free(pipex->stages);
+	pipex->stages = NULL;
 }
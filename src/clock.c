@@ -0,0 +1,41 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   clock.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:11:01 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 00:53:55 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+double	elapsed_ms(struct timespec *start, struct timespec *end)
+{
+	return ((end->tv_sec - start->tv_sec) * 1e3
+		+ (end->tv_nsec - start->tv_nsec) / 1e6);
+}
+
+double	usage_ms(struct timeval *tv)
+{
+	return (tv->tv_sec * 1e3 + tv->tv_usec / 1e3);
+}
+
+void	ts_add_ms(struct timespec *at, long long ms)
+{
+	at->tv_sec += ms / 1000;
+	at->tv_nsec += ms % 1000 * 1000000;
+	if (at->tv_nsec >= 1000000000)
+	{
+		at->tv_sec++;
+		at->tv_nsec -= 1000000000;
+	}
+}
+
+void	deadline_ms(struct timespec *at, long long ms)
+{
+	clock_gettime(CLOCK_MONOTONIC, at);
+	ts_add_ms(at, ms);
+}
@@ -6,7 +6,7 @@
 /*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/10 13:15:43 by dancuenc          #+#    #+#             */
-/*   Updated: 2025/07/10 13:18:36 by dancuenc         ###   ########.fr       */
+/*   Updated: 2026/10/18 01:40:24 by dancuenc         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,43 +16,34 @@ void	redirect_io(int input_fd, int output_fd)
 {
 	dup2(input_fd, STDIN_FILENO);
 	dup2(output_fd, STDOUT_FILENO);
+	if (input_fd == STDIN_FILENO)
+		fcntl(STDIN_FILENO, F_SETFD, 0);
+	if (output_fd == STDOUT_FILENO)
+		fcntl(STDOUT_FILENO, F_SETFD, 0);
 }
 
 void	setup_child_io(t_pipex *pipex)
 {
-	if (pipex->idx == 0)
+	if (stage_in_fd(pipex) == -1 || stage_out_fd(pipex) == -1)
 	{
-		if (pipex->in_fd == -1)
-		{
-			parent_free(pipex);
-			exit(1);
-		}
-		redirect_io(pipex->in_fd, pipex->pipes[1]);
-	}
-	else if (pipex->idx == pipex->cmd_count - 1)
-	{
-		if (pipex->out_fd != -1)
-			redirect_io(pipex->pipes[2 * pipex->idx - 2], pipex->out_fd);
-		else
-		{
-			parent_free(pipex);
-			exit(1);
-		}
-	}
-	else
-	{
-		redirect_io(pipex->pipes[2 * pipex->idx - 2], pipex->pipes[2
-			* pipex->idx + 1]);
+		parent_free(pipex);
+		exit(1);
 	}
+	redirect_io(stage_in_fd(pipex), stage_out_fd(pipex));
 }
 
 void	handle_child_error(t_pipex *pipex, int saved_stdout)
 {
 	if (!pipex->cmd_paths[pipex->idx])
 	{
-		dup2(saved_stdout, STDOUT_FILENO);
+		if (pipex->opts.batch)
+			dup2(STDERR_FILENO, STDOUT_FILENO);
+		else
+			dup2(saved_stdout, STDOUT_FILENO);
 		close(saved_stdout);
-		ft_printf("%s: command not found\n", pipex->cmd_args[pipex->idx][0]);
+		if (pipex->cmd_args[pipex->idx][0])
+			ft_printf("%s", pipex->cmd_args[pipex->idx][0]);
+		ft_printf(": command not found\n");
 		parent_free(pipex);
 		exit(127);
 	}
@@ -63,24 +54,39 @@ void	execute_child_command(t_pipex *pipex, char **envp)
 	char	*cmd;
 	char	**cmd_args;
 
+	run_builtin(pipex);
 	cmd = pipex->cmd_paths[pipex->idx];
 	cmd_args = pipex->cmd_args[pipex->idx];
-	execve(cmd, cmd_args, envp);
+	if (pipex->cmd_dirs && pipex->cmd_dirs[pipex->idx] >= 0)
+		execveat(pidx_exec_fd(pipex), "", cmd_args, envp, AT_EMPTY_PATH);
+	else
+		execve(cmd, cmd_args, envp);
 }
 
 void	create_child_process(t_pipex *pipex, char **envp)
 {
 	int	saved_stdout;
 
+	clock_gettime(CLOCK_MONOTONIC, &pipex->stages[pipex->idx].start);
+	if (!launch_stage(pipex, envp))
+	{
+		pipex->stages[pipex->idx].pid = pipex->pid;
+		return ;
+	}
 	pipex->pid = fork();
+	pipex->stages[pipex->idx].pid = pipex->pid;
 	if (pipex->pid == -1)
 		handle_error("Fork failed");
 	if (pipex->pid == 0)
 	{
-		saved_stdout = dup(STDOUT_FILENO);
+		saved_stdout = fcntl(STDOUT_FILENO, F_DUPFD_CLOEXEC, 0);
 		setup_child_io(pipex);
-		close_pipes(pipex);
+		place_stage(pipex);
+		resolve_in_child(pipex);
 		handle_child_error(pipex, saved_stdout);
 		execute_child_command(pipex, envp);
+		handle_error(pipex->cmd_paths[pipex->idx]);
+		parent_free(pipex);
+		exit(126);
 	}
 }
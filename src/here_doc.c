@@ -6,7 +6,7 @@
 /*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/10 13:15:49 by dancuenc          #+#    #+#             */
-/*   Updated: 2025/07/10 16:31:08 by dancuenc         ###   ########.fr       */
+/*   Updated: 2026/10/18 01:24:06 by dancuenc         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -23,59 +23,69 @@ int	check_and_set_heredoc(char *arg, t_pipex *pipex)
 	return (5);
 }
 
-int	create_heredoc_file(void)
-{
-	int	fd;
-
-	fd = open(".heredoc_tmp", O_CREAT | O_WRONLY | O_TRUNC, 0644);
-	if (fd < 0)
-		handle_error(ERR_HEREDOC);
-	return (fd);
-}
-
-void	process_heredoc_input(char *limiter, int fd)
+/**
+ * @brief Prompts for and copies lines from a terminal until the
+ * limiter, end of input or a write error.
+ *
+ * @param rd Reader over stdin.
+ * @param limiter The here_doc limiter.
+ * @param sink Where the lines go.
+ */
+static void	heredoc_prompt(t_reader *rd, char *limiter, t_hdsink *sink)
 {
-	char	*buf;
+	t_line	line;
 	size_t	lim_len;
 
 	lim_len = ft_strlen(limiter);
 	while (1)
 	{
 		write(1, "heredoc> ", 9);
-		buf = get_next_line(STDIN_FILENO);
-		if (!buf)
+		if (ft_reader_line(rd, &line) <= 0)
 			break ;
-		if (!ft_strncmp(limiter, buf, lim_len) && buf[lim_len] == '\n')
-		{
-			free(buf);
+		if (line.len == lim_len + 1 && line.ptr[lim_len] == '\n'
+			&& !ft_memcmp(line.ptr, limiter, lim_len))
+			break ;
+		if (heredoc_write(sink, line.ptr, line.len) < 0)
 			break ;
-		}
-		write(fd, buf, ft_strlen(buf));
-		free(buf);
 	}
 }
 
-/**
- * @brief Finalizes the heredoc by opening the temporary file.
- *
- * @param pipex Pointer to the pipex struct.
- */
-void	finalize_heredoc(t_pipex *pipex)
+void	process_heredoc_input(char *limiter, t_hdsink *sink)
 {
-	pipex->in_fd = open(".heredoc_tmp", O_RDONLY);
-	if (pipex->in_fd < 0)
+	t_reader	rd;
+
+	if (!isatty(STDIN_FILENO))
+	{
+		heredoc_bulk(limiter, sink);
+		return ;
+	}
+	if (ft_reader_init(&rd, STDIN_FILENO) < 0)
 	{
-		unlink(".heredoc_tmp");
 		handle_error(ERR_HEREDOC);
+		return ;
 	}
+	heredoc_prompt(&rd, limiter, sink);
+	ft_reader_free(&rd);
 }
 
 void	handle_heredoc(char *limiter, t_pipex *pipex)
 {
-	int	fd;
+	t_hdsink	sink;
 
-	fd = create_heredoc_file();
-	process_heredoc_input(limiter, fd);
-	close(fd);
-	finalize_heredoc(pipex);
+	pipex->in_fd = -1;
+	if (pipex->opts.heredoc_mode == HEREDOC_STREAM)
+	{
+		stream_heredoc(limiter, pipex);
+		return ;
+	}
+	if (heredoc_sink_open(&sink, pipex) < 0)
+		return ;
+	process_heredoc_input(limiter, &sink);
+	if (lseek(sink.fd, 0, SEEK_SET) < 0)
+	{
+		handle_error(ERR_HEREDOC);
+		close(sink.fd);
+		return ;
+	}
+	pipex->in_fd = sink.fd;
 }
@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc_bulk.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:15:09 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/17 23:15:09 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Writes buf[skip, upto) to the sink and keeps buf[upto, len).
+ *
+ * @param b Bulk reader state.
+ * @param sink The sink to write to.
+ * @param upto End of the bytes to write.
+ * @return 0 on success, -1 on a write error.
+ */
+static int	bulk_flush(t_bulk *b, t_hdsink *sink, size_t upto)
+{
+	if (upto > b->skip
+		&& heredoc_write(sink, b->buf + b->skip, upto - b->skip) < 0)
+		return (-1);
+	ft_memmove(b->buf, b->buf + upto, b->len - upto);
+	b->len -= upto;
+	b->skip = 0;
+	return (0);
+}
+
+/**
+ * @brief Looks for "\nLIMITER\n" in the buffer and writes what precedes it.
+ *
+ * Without a match, everything but the last plen - 1 bytes is written, so
+ * a limiter split across two reads is still found on the next scan.
+ *
+ * @param b Bulk reader state.
+ * @param sink The sink to write to.
+ * @return 1 once the limiter was found or on error, 0 to keep reading.
+ */
+static int	bulk_scan(t_bulk *b, t_hdsink *sink)
+{
+	char	*match;
+
+	match = memmem(b->buf, b->len, b->pat, b->plen);
+	if (match)
+	{
+		bulk_flush(b, sink, match - b->buf + 1);
+		return (1);
+	}
+	if (b->len >= b->plen && bulk_flush(b, sink, b->len - b->plen + 1) < 0)
+		return (1);
+	return (0);
+}
+
+/**
+ * @brief Builds "\nLIMITER\n" and the block buffer.
+ *
+ * The buffer starts with a virtual '\n' (skipped when writing) so a
+ * limiter on the very first line matches the same pattern.
+ *
+ * @param b Bulk reader state.
+ * @param limiter The limiter string.
+ * @return 0 on success, -1 on allocation failure.
+ */
+static int	bulk_init(t_bulk *b, char *limiter)
+{
+	size_t	lim_len;
+
+	lim_len = ft_strlen(limiter);
+	b->plen = lim_len + 2;
+	b->cap = HEREDOC_BLOCK + b->plen;
+	b->pat = malloc(b->plen);
+	b->buf = malloc(b->cap);
+	if (!b->pat || !b->buf)
+	{
+		free(b->pat);
+		free(b->buf);
+		return (-1);
+	}
+	b->pat[0] = '\n';
+	ft_memcpy(b->pat + 1, limiter, lim_len);
+	b->pat[b->plen - 1] = '\n';
+	b->buf[0] = '\n';
+	b->len = 1;
+	b->skip = 1;
+	return (0);
+}
+
+void	heredoc_bulk(char *limiter, t_hdsink *sink)
+{
+	t_bulk	b;
+	ssize_t	bytes_read;
+
+	if (bulk_init(&b, limiter) < 0)
+	{
+		handle_error(ERR_HEREDOC);
+		return ;
+	}
+	while (1)
+	{
+		bytes_read = read(STDIN_FILENO, b.buf + b.len, b.cap - b.len);
+		if (bytes_read < 0 && errno == EINTR)
+			continue ;
+		if (bytes_read <= 0)
+		{
+			bulk_flush(&b, sink, b.len);
+			break ;
+		}
+		b.len += bytes_read;
+		if (bulk_scan(&b, sink))
+			break ;
+	}
+	free(b.pat);
+	free(b.buf);
+}
@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc_sink.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:14:16 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:12:34 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+char	*temp_dir(t_pipex *pipex)
+{
+	char	*dir;
+
+	dir = pipex->opts.tmpdir;
+	if (!dir)
+		dir = getenv("TMPDIR");
+	if (!dir || !*dir)
+		dir = "/tmp";
+	return (dir);
+}
+
+int	open_anon_file(char *dir)
+{
+	char	path[PATH_MAX];
+	int		fd;
+
+	fd = open(dir, O_TMPFILE | O_RDWR | O_CLOEXEC, 0600);
+	if (fd >= 0 || (errno != EOPNOTSUPP && errno != EISDIR))
+		return (fd);
+	if (snprintf(path, sizeof(path), "%s/.pipex.XXXXXX", dir)
+		>= (int) sizeof(path))
+		return (-1);
+	fd = mkostemp(path, O_CLOEXEC);
+	if (fd >= 0)
+		unlink(path);
+	return (fd);
+}
+
+/**
+ * @brief Moves the in-memory buffer to an anonymous file on disk.
+ *
+ * @param sink The here_doc sink.
+ * @return 0 on success, -1 on error.
+ */
+static int	spill_to_disk(t_hdsink *sink)
+{
+	off_t	offset;
+	ssize_t	copied;
+	int		fd;
+
+	fd = open_anon_file(sink->tmpdir);
+	if (fd < 0)
+		return (-1);
+	offset = 0;
+	while ((size_t)offset < sink->size)
+	{
+		copied = sendfile(fd, sink->fd, &offset, sink->size - offset);
+		if (copied <= 0)
+		{
+			close(fd);
+			return (-1);
+		}
+	}
+	close(sink->fd);
+	sink->fd = fd;
+	sink->spill_at = 0;
+	return (0);
+}
+
+int	heredoc_sink_open(t_hdsink *sink, t_pipex *pipex)
+{
+	sink->size = 0;
+	sink->spill_at = pipex->opts.heredoc_spill;
+	sink->tmpdir = temp_dir(pipex);
+	sink->fd = memfd_create("pipex_here_doc", MFD_CLOEXEC);
+	if (sink->fd >= 0)
+		return (0);
+	sink->spill_at = 0;
+	sink->fd = open_anon_file(sink->tmpdir);
+	if (sink->fd < 0)
+		handle_error(ERR_HEREDOC);
+	return (-(sink->fd < 0));
+}
+
+int	heredoc_write(t_hdsink *sink, const char *buf, size_t len)
+{
+	ssize_t	written;
+
+	if (sink->spill_at && sink->size + len > sink->spill_at
+		&& spill_to_disk(sink) < 0)
+	{
+		handle_error(ERR_HEREDOC);
+		sink->spill_at = 0;
+	}
+	while (len > 0)
+	{
+		written = write(sink->fd, buf, len);
+		if (written < 0 && errno == EINTR)
+			continue ;
+		if (written < 0)
+			return (-1);
+		buf += written;
+		len -= written;
+		sink->size += written;
+	}
+	return (0);
+}
@@ -0,0 +1,65 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc_stream.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:12:39 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:23:44 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Body of the feeder child: copies here_doc input into the
+ * first stage's pipe, then exits.
+ *
+ * @param limiter The here_doc limiter.
+ * @param fds The pipe; the read end is closed here.
+ */
+static void	feed_heredoc(char *limiter, int fds[2])
+{
+	t_hdsink	sink;
+
+	close(fds[0]);
+	ft_bzero(&sink, sizeof(sink));
+	sink.fd = fds[1];
+	process_heredoc_input(limiter, &sink);
+	close(fds[1]);
+	exit(0);
+}
+
+void	stream_heredoc(char *limiter, t_pipex *pipex)
+{
+	int	fds[2];
+
+	pipex->in_fd = -1;
+	if (pipe2(fds, O_CLOEXEC) < 0)
+	{
+		handle_error(ERR_HEREDOC);
+		return ;
+	}
+	pipex->heredoc_pid = fork();
+	if (pipex->heredoc_pid == 0)
+		feed_heredoc(limiter, fds);
+	close(fds[1]);
+	if (pipex->heredoc_pid < 0)
+	{
+		handle_error(ERR_HEREDOC);
+		close(fds[0]);
+		return ;
+	}
+	pipex->in_fd = fds[0];
+}
+
+void	stop_heredoc_feeder(t_pipex *pipex, pid_t reaped)
+{
+	if (pipex->heredoc_pid <= 0 || !pipex->stages)
+		return ;
+	if (reaped == pipex->heredoc_pid)
+		pipex->heredoc_pid = 0;
+	else if (reaped == pipex->stages[0].pid)
+		kill(pipex->heredoc_pid, SIGPIPE);
+}
@@ -6,7 +6,7 @@
 /*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/10 13:15:55 by dancuenc          #+#    #+#             */
-/*   Updated: 2025/07/10 13:18:51 by dancuenc         ###   ########.fr       */
+/*   Updated: 2026/10/18 01:56:51 by dancuenc         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,25 +14,39 @@
 
 void	get_infile(char **argv, t_pipex *pipex)
 {
+	struct stat	st;
+
+	pipex->in_size = -1;
 	if (pipex->here_doc)
 		handle_heredoc(argv[2], pipex);
+	else if (pipex->chunk)
+		feed_chunk(argv[1], pipex);
 	else
 	{
-		pipex->in_fd = open(argv[1], O_RDONLY);
+		pipex->in_fd = open(argv[1], O_RDONLY | O_CLOEXEC);
 		if (pipex->in_fd < 0)
 		{
 			perror(ERR_INFILE);
 			pipex->in_fd = -1;
 		}
+		else if (fstat(pipex->in_fd, &st) == 0 && S_ISREG(st.st_mode))
+			pipex->in_size = st.st_size;
 	}
 }
 
 void	get_outfile(char *argv, t_pipex *pipex)
 {
+	if (pipex->chunk)
+	{
+		pipex->out_fd = pipex->chunk->out;
+		return ;
+	}
 	if (pipex->here_doc)
-		pipex->out_fd = open(argv, O_WRONLY | O_CREAT | O_APPEND, 0000644);
+		pipex->out_fd = open(argv, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC,
+				0000644);
 	else
-		pipex->out_fd = open(argv, O_CREAT | O_RDWR | O_TRUNC, 0000644);
+		pipex->out_fd = open(argv, O_CREAT | O_RDWR | O_TRUNC | O_CLOEXEC,
+				0000644);
 	if (pipex->out_fd < 0)
 	{
 		perror(ERR_OUTFILE);
@@ -42,11 +56,26 @@ void	get_outfile(char *argv, t_pipex *pipex)
 
 void	init_files(char **argv, int argc, t_pipex *pipex)
 {
+	int	i;
+
+	pipex->prev_fd = -1;
+	pipex->cut_stage = -1;
+	pipex->pipe_fd[0] = -1;
+	pipex->pipe_fd[1] = -1;
 	get_infile(argv, pipex);
 	get_outfile(argv[argc - 1], pipex);
 	pipex->cmd_count = argc - 3 - pipex->here_doc;
-	pipex->pipe_count = 2 * (pipex->cmd_count - 1);
-	pipex->pipes = (int *)malloc(sizeof(int) * (pipex->pipe_count));
-	if (!pipex->pipes)
-		handle_error(ERR_PIPE);
+	pipex->stages = ft_calloc(pipex->cmd_count, sizeof(t_stage));
+	if (!pipex->stages)
+	{
+		handle_error("Memory allocation failed for stages");
+		parent_free(pipex);
+		exit(1);
+	}
+	i = -1;
+	while (++i < pipex->cmd_count)
+	{
+		pipex->stages[i].pidfd = -1;
+		pipex->stages[i].pipe_rd = -1;
+	}
 }
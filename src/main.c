@@ -6,7 +6,7 @@
 /*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/10 13:16:00 by dancuenc          #+#    #+#             */
-/*   Updated: 2025/07/10 17:13:56 by dancuenc         ###   ########.fr       */
+/*   Updated: 2026/10/18 01:14:23 by dancuenc         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,25 +16,35 @@
 /**
  * @brief Initializes and validates command-line arguments and heredoc mode.
  *
- * Sets all fields of the pipex struct to zero and
- * checks for heredoc mode and argument count.
+ * Sets all fields of the pipex struct to zero, consumes the leading
+ * options and checks for heredoc mode and argument count. With --batch
+ * the pipelines come from the manifest, so nothing is checked.
  *
- * @param ac Argument count.
- * @param av Argument vector.
+ * @param ac Pointer to the argument count, shifted past the options.
+ * @param av Pointer to the argument vector, shifted past the options.
  * @param pipex Pointer to the pipex struct to initialize.
  * @return 0 on success, 1 on error.
  */
-static int	initialize_and_validate(int ac, char **av, t_pipex *pipex)
+static int	initialize_and_validate(int *ac, char ***av, t_pipex *pipex)
 {
+	int	consumed;
+
 	memset(pipex, 0, sizeof(*pipex));
-	if (ac < check_and_set_heredoc(av[1], pipex))
+	consumed = parse_options(*ac, *av, pipex);
+	if (consumed < 0)
+		return (1);
+	*ac -= consumed;
+	*av += consumed;
+	if (pipex->opts.batch)
+		return (0);
+	if (*ac < 2 || *ac < check_and_set_heredoc((*av)[1], pipex))
 		return (handle_msg(ERR_INPUT));
 	return (0);
 }
 
 /**
- * @brief Sets up files, parses commands and paths, creates pipes,
- * and executes child processes.
+ * @brief Sets up files, parses commands and paths, and executes child
+ * processes, opening each pipe just before the stage that writes to it.
  *
  * @param pipex Pointer to the pipex struct.
  * @param ac Argument count.
@@ -46,11 +56,20 @@ static void	setup_and_execute(t_pipex *pipex, int ac,
 {
 	init_files(av, ac, pipex);
 	parse_cmds(pipex, av);
+	if (pipex->opts.optimize)
+		plan_optimize(pipex, pipex->in_fd >= 0);
+	if (copy_passthrough(pipex))
+		return ;
 	parse_paths(pipex, envp);
-	create_pipes(pipex);
+	place_init(pipex);
 	pipex->idx = -1;
 	while (++(pipex->idx) < pipex->cmd_count)
+	{
+		if (open_stage_pipe(pipex))
+			break ;
 		create_child_process(pipex, envp);
+		advance_pipes(pipex);
+	}
 	close_pipes(pipex);
 }
 
@@ -58,6 +77,10 @@ static void	setup_and_execute(t_pipex *pipex, int ac,
  * @brief Waits for all child processes and
  * returns the exit status of the last command.
  *
+ * With --short-circuit or a timeout the stages are waited for by
+ * supervise first; the loop then reaps whatever is left, such as the
+ * here_doc feeder.
+ *
  * @param pipex Pointer to the pipex struct.
  * @return Exit status of the last executed command.
  */
@@ -67,26 +90,43 @@ static int	handle_exit_status(t_pipex *pipex)
 	int	last_exit_status;
 	int	last_exit_id;
 
-	last_exit_status = 0;
-	last_exit_id = waitpid(-1, &status, 0);
+	last_exit_status = pipex->copy_status;
+	if (pipex->opts.supervise)
+		last_exit_status = supervise(pipex, last_exit_status);
+	last_exit_id = reap_child(pipex, &status);
 	while (last_exit_id > 0)
 	{
 		if (WIFEXITED(status) && pipex->pid == last_exit_id)
 			last_exit_status = WEXITSTATUS(status);
-		last_exit_id = waitpid(-1, &status, 0);
+		stop_heredoc_feeder(pipex, last_exit_id);
+		last_exit_id = reap_child(pipex, &status);
 	}
 	return (last_exit_status);
 }
 
+int	run_pipeline(t_pipex *pipex, int ac, char **av, char **envp)
+{
+	int	exit_status;
+
+	setup_and_execute(pipex, ac, av, envp);
+	exit_status = handle_exit_status(pipex);
+	if (pipex->opts.stats != STATS_NONE)
+		report_stats(pipex);
+	parent_free(pipex);
+	return (exit_status);
+}
+
 int	main(int argc, char **argv, char **envp)
 {
 	t_pipex	pipex;
-	int		exit_status;
 
-	if (initialize_and_validate(argc, argv, &pipex))
+	if (initialize_and_validate(&argc, &argv, &pipex))
 		return (1);
-	setup_and_execute(&pipex, argc, argv, envp);
-	exit_status = handle_exit_status(&pipex);
-	parent_free(&pipex);
-	return (exit_status);
+	if (pipex.opts.batch)
+		return (run_batch(&pipex, envp));
+	if (pipex.opts.explain)
+		return (plan_explain(&pipex, argc, argv));
+	if (pipex.opts.split > 1)
+		return (run_split(&pipex, argc, argv, envp));
+	return (run_pipeline(&pipex, argc, argv, envp));
 }
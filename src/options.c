@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:07:41 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:27:48 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Returns the options that shape how stages are set up and run.
+ *
+ * @return Option table terminated by a NULL name.
+ */
+static const t_option	*option_table_setup(void)
+{
+	static const t_option	table[] = {
+	{"spawn", opt_spawn},
+	{"heredoc", opt_heredoc},
+	{"heredoc-spill", opt_heredoc_spill},
+	{"tmpdir", opt_tmpdir},
+	{"stats", opt_stats},
+	{"stats-file", opt_stats_file},
+	{"path-cache", opt_path_cache},
+	{"path-index", opt_path_index},
+	{"lazy-resolve", opt_lazy_resolve},
+	{"no-builtins", opt_no_builtins},
+	{"optimize", opt_optimize},
+	{"explain", opt_explain},
+	{"split", opt_split},
+	{NULL, NULL}
+	};
+
+	return (table);
+}
+
+/**
+ * @brief Returns the options that limit, schedule and batch pipelines.
+ *
+ * @return Option table terminated by a NULL name.
+ */
+static const t_option	*option_table_run(void)
+{
+	static const t_option	table[] = {
+	{"short-circuit", opt_short_circuit},
+	{"timeout", opt_timeout},
+	{"stage-timeout", opt_stage_timeout},
+	{"kill-after", opt_kill_after},
+	{"pipe-size", opt_pipe_size},
+	{"pin", opt_pin},
+	{"sched", opt_sched},
+	{"nice", opt_nice},
+	{"ioprio", opt_ioprio},
+	{"batch", opt_batch},
+	{"jobs", opt_jobs},
+	{"batch-order", opt_batch_order},
+	{"max-procs", opt_max_procs},
+	{"max-fds", opt_max_fds},
+	{NULL, NULL}
+	};
+
+	return (table);
+}
+
+/**
+ * @brief Finds the option whose name is the first len bytes of arg.
+ *
+ * @param opt Option table terminated by a NULL name.
+ * @param arg The argument, without the leading "--".
+ * @param len Length of the name part of arg.
+ * @return The matching entry, or NULL.
+ */
+static const t_option	*find_option(const t_option *opt, char *arg,
+		size_t len)
+{
+	while (opt->name)
+	{
+		if (ft_strlen(opt->name) == len && !ft_strncmp(opt->name, arg, len))
+			return (opt);
+		opt++;
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Looks up and applies a single --name[=value] argument.
+ *
+ * @param arg The argument, without the leading "--".
+ * @param pipex Pointer to the pipex struct.
+ * @return 0 on success, 1 on an unknown or malformed option.
+ */
+static int	apply_option(char *arg, t_pipex *pipex)
+{
+	const t_option	*opt;
+	size_t			len;
+	char			*value;
+
+	value = ft_strchr(arg, '=');
+	len = ft_strlen(arg);
+	if (value)
+	{
+		len = value - arg;
+		value++;
+	}
+	opt = find_option(option_table_setup(), arg, len);
+	if (!opt)
+		opt = find_option(option_table_run(), arg, len);
+	if (!opt)
+		return (1);
+	return (opt->apply(value, pipex));
+}
+
+int	parse_options(int ac, char **av, t_pipex *pipex)
+{
+	int	i;
+
+	pipex->opts.heredoc_spill = HEREDOC_SPILL;
+	pipex->opts.kill_ms = KILL_AFTER;
+	pipex->opts.jobs = sysconf(_SC_NPROCESSORS_ONLN);
+	i = 1;
+	while (i < ac && !ft_strncmp(av[i], "--", 2))
+	{
+		if (av[i][2] == '\0')
+			return (i);
+		if (apply_option(av[i] + 2, pipex))
+		{
+			handle_msg(ERR_OPTION);
+			handle_msg(av[i]);
+			handle_msg("\n");
+			return (-1);
+		}
+		i++;
+	}
+	return (i - 1);
+}
@@ -0,0 +1,62 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options_batch.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:06:04 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:06:04 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+int	opt_batch(char *value, t_pipex *pipex)
+{
+	if (!value || !*value)
+		return (1);
+	pipex->opts.batch = value;
+	return (0);
+}
+
+int	opt_jobs(char *value, t_pipex *pipex)
+{
+	long long	n;
+
+	if (!value || bi_number(value, &n) || n < 1 || n > INT_MAX)
+		return (1);
+	pipex->opts.jobs = n;
+	return (0);
+}
+
+int	opt_batch_order(char *value, t_pipex *pipex)
+{
+	if (value && !ft_strncmp(value, "manifest", 9))
+		pipex->opts.batch_order = BATCH_MANIFEST;
+	else if (value && !ft_strncmp(value, "completion", 11))
+		pipex->opts.batch_order = BATCH_COMPLETION;
+	else
+		return (1);
+	return (0);
+}
+
+int	opt_max_procs(char *value, t_pipex *pipex)
+{
+	long long	n;
+
+	if (!value || bi_number(value, &n) || n > INT_MAX)
+		return (1);
+	pipex->opts.max_procs = n;
+	return (0);
+}
+
+int	opt_max_fds(char *value, t_pipex *pipex)
+{
+	long long	n;
+
+	if (!value || bi_number(value, &n) || n > INT_MAX)
+		return (1);
+	pipex->opts.max_fds = n;
+	return (0);
+}
@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options_exec.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:14:16 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/17 23:27:46 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+int	opt_spawn(char *value, t_pipex *pipex)
+{
+	if (!value)
+		return (1);
+	if (!ft_strncmp(value, "fork", 5))
+		pipex->opts.spawn_mode = SPAWN_FORK;
+	else if (!ft_strncmp(value, "vfork", 6))
+		pipex->opts.spawn_mode = SPAWN_VFORK;
+	else if (!ft_strncmp(value, "posix_spawn", 12))
+		pipex->opts.spawn_mode = SPAWN_POSIX;
+	else
+		return (1);
+	return (0);
+}
+
+int	opt_path_cache(char *value, t_pipex *pipex)
+{
+	if (value && !*value)
+		return (1);
+	pipex->opts.path_cache = 1;
+	pipex->opts.path_cache_file = value;
+	return (0);
+}
+
+int	opt_path_index(char *value, t_pipex *pipex)
+{
+	if (value)
+		return (1);
+	pipex->opts.path_index = 1;
+	return (0);
+}
+
+int	opt_lazy_resolve(char *value, t_pipex *pipex)
+{
+	if (value)
+		return (1);
+	pipex->opts.lazy_resolve = 1;
+	return (0);
+}
+
+int	opt_no_builtins(char *value, t_pipex *pipex)
+{
+	if (value)
+		return (1);
+	pipex->opts.no_builtins = 1;
+	return (0);
+}
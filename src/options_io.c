@@ -0,0 +1,41 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options_io.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:14:16 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/17 23:14:16 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+int	opt_heredoc(char *value, t_pipex *pipex)
+{
+	if (!value)
+		return (1);
+	if (!ft_strncmp(value, "buffer", 7))
+		pipex->opts.heredoc_mode = HEREDOC_BUFFER;
+	else if (!ft_strncmp(value, "stream", 7))
+		pipex->opts.heredoc_mode = HEREDOC_STREAM;
+	else
+		return (1);
+	return (0);
+}
+
+int	opt_heredoc_spill(char *value, t_pipex *pipex)
+{
+	if (!value)
+		return (1);
+	return (parse_size(value, &pipex->opts.heredoc_spill));
+}
+
+int	opt_tmpdir(char *value, t_pipex *pipex)
+{
+	if (!value || !*value)
+		return (1);
+	pipex->opts.tmpdir = value;
+	return (0);
+}
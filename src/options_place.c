@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options_place.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:01:02 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:01:02 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Starts a per-stage setting: consumes its "N:" prefix and
+ * returns the entry to fill.
+ *
+ * The entry only counts once the caller increments place_count.
+ *
+ * @param value The option value; moved past the prefix.
+ * @param pipex Pointer to the pipex struct.
+ * @param kind PLACE_SCHED, PLACE_NICE or PLACE_IOPRIO.
+ * @return The entry, or NULL on a malformed prefix or a full table.
+ */
+static t_stageplace	*place_add(char **value, t_pipex *pipex, int kind)
+{
+	t_stageplace	*pl;
+
+	if (!*value || pipex->opts.place_count >= PLACE_MAX)
+		return (NULL);
+	pl = &pipex->opts.place[pipex->opts.place_count];
+	if (parse_stage_prefix(value, 1, &pl->stage))
+		return (NULL);
+	pl->kind = kind;
+	pipex->opts.placed = 1;
+	return (pl);
+}
+
+int	opt_pin(char *value, t_pipex *pipex)
+{
+	if (!value)
+		return (1);
+	if (!ft_strncmp(value, "compact", 8))
+		pipex->opts.pin = PIN_COMPACT;
+	else if (!ft_strncmp(value, "domain", 7))
+		pipex->opts.pin = PIN_DOMAIN;
+	else
+		return (1);
+	pipex->opts.placed = 1;
+	return (0);
+}
+
+int	opt_sched(char *value, t_pipex *pipex)
+{
+	t_stageplace	*pl;
+
+	pl = place_add(&value, pipex, PLACE_SCHED);
+	if (!pl)
+		return (1);
+	if (!ft_strncmp(value, "batch", 6))
+		pl->value = SCHED_BATCH;
+	else if (!ft_strncmp(value, "idle", 5))
+		pl->value = SCHED_IDLE;
+	else if (!ft_strncmp(value, "other", 6))
+		pl->value = SCHED_OTHER;
+	else
+		return (1);
+	pipex->opts.place_count++;
+	return (0);
+}
+
+int	opt_nice(char *value, t_pipex *pipex)
+{
+	t_stageplace	*pl;
+	long long		n;
+	int				neg;
+
+	pl = place_add(&value, pipex, PLACE_NICE);
+	if (!pl)
+		return (1);
+	neg = (*value == '-');
+	if (bi_number(value + neg, &n) || n > 19 + neg)
+		return (1);
+	pl->value = n;
+	if (neg)
+		pl->value = -n;
+	pipex->opts.place_count++;
+	return (0);
+}
+
+int	opt_ioprio(char *value, t_pipex *pipex)
+{
+	t_stageplace	*pl;
+	long long		level;
+	char			*comma;
+	size_t			len;
+
+	pl = place_add(&value, pipex, PLACE_IOPRIO);
+	if (!pl)
+		return (1);
+	level = IOPRIO_NORM;
+	comma = ft_strchr(value, ',');
+	len = ft_strlen(value);
+	if (comma)
+		len = comma - value;
+	if (comma && (bi_number(comma + 1, &level) || level > 7))
+		return (1);
+	if (len == 2 && !ft_strncmp(value, "rt", 2))
+		pl->value = IOPRIO_PRIO_VALUE(IOPRIO_CLASS_RT, level);
+	else if (len == 2 && !ft_strncmp(value, "be", 2))
+		pl->value = IOPRIO_PRIO_VALUE(IOPRIO_CLASS_BE, level);
+	else if (len == 4 && !ft_strncmp(value, "idle", 4) && !comma)
+		pl->value = IOPRIO_PRIO_VALUE(IOPRIO_CLASS_IDLE, 0);
+	else
+		return (1);
+	pipex->opts.place_count++;
+	return (0);
+}
@@ -0,0 +1,39 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options_plan.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:38:33 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:12:34 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+int	opt_optimize(char *value, t_pipex *pipex)
+{
+	if (value)
+		return (1);
+	pipex->opts.optimize = 1;
+	return (0);
+}
+
+int	opt_explain(char *value, t_pipex *pipex)
+{
+	if (value)
+		return (1);
+	pipex->opts.explain = 1;
+	return (0);
+}
+
+int	opt_split(char *value, t_pipex *pipex)
+{
+	long long	n;
+
+	if (!value || bi_number(value, &n) || n < 1 || n > SPLIT_MAX)
+		return (1);
+	pipex->opts.split = n;
+	return (0);
+}
@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options_run.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:49:26 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 00:56:58 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+int	opt_short_circuit(char *value, t_pipex *pipex)
+{
+	long long	grace;
+
+	grace = SHORT_GRACE;
+	if (value && (bi_number(value, &grace) || grace > INT_MAX))
+		return (1);
+	pipex->opts.short_circuit = 1;
+	pipex->opts.grace_ms = grace;
+	pipex->opts.supervise = 1;
+	return (0);
+}
+
+int	opt_timeout(char *value, t_pipex *pipex)
+{
+	if (!value || parse_secs(value, &pipex->opts.timeout_ms))
+		return (1);
+	pipex->opts.supervise = 1;
+	return (0);
+}
+
+int	opt_stage_timeout(char *value, t_pipex *pipex)
+{
+	t_stagetmo	*tmo;
+
+	if (!value || pipex->opts.stage_tmo_count >= STAGE_TMO_MAX)
+		return (1);
+	tmo = &pipex->opts.stage_tmo[pipex->opts.stage_tmo_count];
+	if (parse_stage_prefix(&value, 1, &tmo->stage)
+		|| parse_secs(value, &tmo->ms))
+		return (1);
+	pipex->opts.stage_tmo_count++;
+	pipex->opts.supervise = 1;
+	return (0);
+}
+
+int	opt_kill_after(char *value, t_pipex *pipex)
+{
+	if (!value)
+		return (1);
+	return (parse_secs(value, &pipex->opts.kill_ms));
+}
+
+int	opt_pipe_size(char *value, t_pipex *pipex)
+{
+	t_pipesz	*sz;
+
+	if (value && !ft_strncmp(value, "auto", 5))
+		pipex->opts.pipe_auto = 1;
+	pipex->opts.supervise |= pipex->opts.pipe_auto;
+	if (!value || pipex->opts.pipe_auto)
+		return (!value);
+	if (pipex->opts.pipe_sz_count >= PIPE_SIZE_MAX)
+		return (1);
+	sz = &pipex->opts.pipe_sz[pipex->opts.pipe_sz_count];
+	if (parse_stage_prefix(&value, 2, &sz->stage)
+		|| parse_size(value, &sz->bytes) || sz->bytes > INT_MAX)
+		return (1);
+	pipex->opts.pipe_sz_count++;
+	return (0);
+}
@@ -0,0 +1,34 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options_stats.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:14:16 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/17 23:14:16 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+int	opt_stats(char *value, t_pipex *pipex)
+{
+	if (!value || !ft_strncmp(value, "text", 5))
+		pipex->opts.stats = STATS_TEXT;
+	else if (!ft_strncmp(value, "json", 5))
+		pipex->opts.stats = STATS_JSON;
+	else
+		return (1);
+	return (0);
+}
+
+int	opt_stats_file(char *value, t_pipex *pipex)
+{
+	if (!value || !*value)
+		return (1);
+	pipex->opts.stats_file = value;
+	if (pipex->opts.stats == STATS_NONE)
+		pipex->opts.stats = STATS_TEXT;
+	return (0);
+}
@@ -0,0 +1,83 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options_utils.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:14:16 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 00:57:38 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+int	parse_size(const char *str, size_t *size)
+{
+	unsigned long long	value;
+	char				*end;
+
+	if (!ft_isdigit(*str))
+		return (1);
+	errno = 0;
+	value = strtoull(str, &end, 10);
+	if (*end == 'K' || *end == 'k')
+		value <<= 10;
+	else if (*end == 'M' || *end == 'm')
+		value <<= 20;
+	else if (*end == 'G' || *end == 'g')
+		value <<= 30;
+	if (*end && ft_strchr("KkMmGg", *end))
+		end++;
+	if (*end || errno)
+		return (1);
+	*size = value;
+	return (0);
+}
+
+int	parse_secs(const char *str, long long *ms)
+{
+	unsigned long long	secs;
+	long long			frac;
+	int					digits;
+	char				*end;
+
+	if (!ft_isdigit(*str))
+		return (1);
+	errno = 0;
+	secs = strtoull(str, &end, 10);
+	frac = 0;
+	digits = 0;
+	if (*end == '.')
+		end++;
+	while (ft_isdigit(*end) && digits < 3)
+	{
+		frac = frac * 10 + (*end++ - '0');
+		digits++;
+	}
+	while (digits++ < 3)
+		frac *= 10;
+	if (*end || errno || secs > INT_MAX)
+		return (1);
+	*ms = secs * 1000 + frac;
+	return (0);
+}
+
+int	parse_stage_prefix(char **value, int min, int *stage)
+{
+	char		*colon;
+	long long	n;
+	int			bad;
+
+	*stage = 0;
+	colon = ft_strchr(*value, ':');
+	if (!colon)
+		return (0);
+	*colon = '\0';
+	bad = (bi_number(*value, &n) || n < min || n > INT_MAX);
+	*colon = ':';
+	*value = colon + 1;
+	if (!bad)
+		*stage = n;
+	return (bad);
+}
@@ -6,12 +6,34 @@
 /*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/10 13:16:06 by dancuenc          #+#    #+#             */
-/*   Updated: 2025/07/10 13:19:07 by dancuenc         ###   ########.fr       */
+/*   Updated: 2026/10/18 01:27:15 by dancuenc         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../include/pipex.h"
 
+/**
+ * @brief Tokenizes command i, reporting an unterminated quote.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param i Index of the command.
+ * @param cmd The command string.
+ */
+static void	parse_cmd(t_pipex *pipex, int i, char *cmd)
+{
+	int	err;
+
+	pipex->cmd_args[i] = tokenize_cmd(&pipex->arena, cmd, &err);
+	if (!pipex->cmd_args[i])
+		handle_error("Memory allocation failed for command");
+	else if (err)
+	{
+		handle_msg(ERR_QUOTE);
+		handle_msg(cmd);
+		handle_msg("\n");
+	}
+}
+
 void	parse_cmds(t_pipex *pipex, char **argv)
 {
 	int	i;
@@ -21,15 +43,14 @@ void	parse_cmds(t_pipex *pipex, char **argv)
 		cmd_start = 3;
 	else
 		cmd_start = 2;
-	pipex->cmd_args = malloc(sizeof(char *) * (pipex->cmd_count + 1));
+	pipex->cmd_args = arena_alloc(&pipex->arena,
+			sizeof(char **) * (pipex->cmd_count + 1));
 	if (!pipex->cmd_args)
 		handle_error("Memory allocation failed for commands");
 	i = 0;
 	while (i < pipex->cmd_count)
 	{
-		pipex->cmd_args[i] = ft_split(argv[cmd_start + i], ' ');
-		if (!pipex->cmd_args[i])
-			handle_error("Memory allocation failed for command");
+		parse_cmd(pipex, i, argv[cmd_start + i]);
 		i++;
 	}
 	pipex->cmd_args[i] = NULL;
@@ -6,7 +6,7 @@
 /*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/07/10 13:16:11 by dancuenc          #+#    #+#             */
-/*   Updated: 2025/07/10 17:14:22 by dancuenc         ###   ########.fr       */
+/*   Updated: 2026/10/18 01:09:13 by dancuenc         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -33,97 +33,79 @@ char	*get_env_path(char **envp)
 	return (NULL);
 }
 
-/**
- * @brief Joins a directory path with a command.
- *
- * @param dir The directory path.
- * @param cmd The command to join.
- * @return The joined path, or NULL if any allocation fails.
- */
-char	*join_path_cmd(char *dir, char *cmd)
+char	*join_path_cmd(char *dir, char *cmd, char *buf)
 {
-	char	*temp;
-	char	*full_path;
-
-	if (!dir || !cmd)
+	if (!dir || !cmd
+		|| snprintf(buf, PATH_MAX, "%s/%s", dir, cmd) >= PATH_MAX)
 		return (NULL);
-	temp = ft_strjoin(dir, "/");
-	if (!temp)
-		return (NULL);
-	full_path = ft_strjoin(temp, cmd);
-	free(temp);
-	return (full_path);
+	return (buf);
 }
 
 /**
- * @brief Finds the path of a command in the given paths.
+ * @brief Splits PATH on ':' into the arena, skipping empty entries.
  *
- * @param paths The paths to search.
- * @param cmd The command to find.
- * @return The path of the command, or NULL if not found.
+ * @param arena The arena.
+ * @param path_env Value of PATH.
+ * @return NULL-terminated directory list, or NULL on allocation failure.
  */
-char	*find_command_path(char **paths, char *cmd)
+static char	**split_path(t_arena *arena, char *path_env)
 {
-	int		j;
-	char	*full_path;
-
-	j = 0;
-	while (paths[j])
-	{
-		full_path = join_path_cmd(paths[j], cmd);
-		if (!full_path)
-			return (NULL);
-		if (access(full_path, X_OK) == 0)
-			return (full_path);
-		free(full_path);
-		j++;
-	}
-	return (NULL);
-}
-
-/**
- * @brief Resolves command paths for the pipex program.
- *
- * @param pipex Pointer to the pipex struct.
- * @param paths The paths to resolve.
- */
-void	resolve_command_paths(t_pipex *pipex, char **paths)
-{
-	int	i;
+	char	**paths;
+	char	*dirs;
+	size_t	n;
+	size_t	i;
 
+	paths = arena_alloc(arena,
+			sizeof(char *) * (ft_strlen(path_env) / 2 + 2));
+	dirs = arena_strdup(arena, path_env);
+	if (!paths || !dirs)
+		return (NULL);
+	n = 0;
 	i = 0;
-	while (i < pipex->cmd_count)
+	while (dirs[i])
 	{
-		if (!pipex->cmd_args[i][0] || pipex->cmd_args[i][0][0] == '\0')
-			pipex->cmd_paths[i] = NULL;
-		else if (access(pipex->cmd_args[i][0], X_OK) == 0)
-			pipex->cmd_paths[i] = ft_strdup(pipex->cmd_args[i][0]);
-		else
-			pipex->cmd_paths[i] = find_command_path(paths,
-					pipex->cmd_args[i][0]);
+		if (dirs[i] != ':' && (i == 0 || dirs[i - 1] == '\0'))
+			paths[n++] = dirs + i;
+		if (dirs[i] == ':')
+			dirs[i] = '\0';
 		i++;
 	}
-	pipex->cmd_paths[i] = NULL;
+	paths[n] = NULL;
+	return (paths);
 }
 
 void	parse_paths(t_pipex *pipex, char **envp)
 {
-	char	*path_env;
-	char	**paths;
-	int		i;
+	char		*path_env;
+	t_pcache	pc;
 
 	path_env = get_env_path(envp);
 	if (!path_env)
 		handle_error("Error: PATH not found");
-	paths = ft_split(path_env, ':');
-	if (!paths)
+	if (!pipex->paths)
+		pipex->paths = split_path(&pipex->arena, path_env);
+	if (!pipex->paths)
 		handle_error("Error: Failed to split PATH");
-	pipex->cmd_paths = malloc(sizeof(char *) * (pipex->cmd_count + 1));
-	if (!pipex->cmd_paths)
+	if (resolve_init(pipex) < 0)
 		handle_error("Error: Memory allocation failed for cmd_paths");
-	resolve_command_paths(pipex, paths);
-	i = 0;
-	while (paths[i])
-		free(paths[i++]);
-	free(paths);
+	if (pipex->opts.lazy_resolve)
+		return ;
+	if (pipex->opts.path_index && pidx_build(pipex, pipex->paths) < 0)
+		pidx_free(pipex);
+	pcache_open(&pc, pipex, path_env, pipex->paths);
+	resolve_command_paths(pipex, pipex->paths, &pc);
+	pcache_close(&pc);
+	pidx_free_table(&pipex->pidx);
+}
+
+void	load_paths(t_pipex *pipex, char **envp)
+{
+	char	*path_env;
+
+	path_env = get_env_path(envp);
+	if (path_env)
+		pipex->paths = split_path(&pipex->arena, path_env);
+	if (pipex->paths && pipex->opts.path_index && !pipex->opts.lazy_resolve
+		&& pidx_build(pipex, pipex->paths) < 0)
+		pidx_free(pipex);
 }
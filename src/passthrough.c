@@ -0,0 +1,157 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   passthrough.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:43:59 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:12:34 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Copies the data extents of a regular file with copy_file_range,
+ * leaving its holes as holes in the outfile.
+ *
+ * Offsets are passed explicitly, so neither descriptor moves and a
+ * fallback can start again from the beginning.
+ *
+ * @param in The infile.
+ * @param out The outfile, just truncated.
+ * @param size Size of the infile.
+ * @return 0 on success, -1 on error, -2 if the kernel cannot do it.
+ */
+static int	copy_range(int in, int out, off_t size)
+{
+	off_t	data;
+	off_t	hole;
+	off_t	dst;
+	ssize_t	n;
+
+	data = 0;
+	n = 1;
+	while (data < size && n > 0)
+	{
+		data = lseek(in, data, SEEK_DATA);
+		if (data < 0 && errno == ENXIO)
+			break ;
+		hole = lseek(in, data, SEEK_HOLE);
+		if (data < 0 || hole < 0)
+			return (-2);
+		while (data < hole && n > 0)
+		{
+			dst = data;
+			n = copy_file_range(in, &data, out, &dst, hole - data, 0);
+		}
+	}
+	if (n < 0 && (errno == EXDEV || errno == EINVAL || errno == ENOSYS
+			|| errno == EOPNOTSUPP))
+		return (-2);
+	return (-(n < 0 || ftruncate(out, size) < 0));
+}
+
+/**
+ * @brief Moves what one splice into the pipe brought on to the outfile.
+ *
+ * @param pipe_rd Read end of the pipe.
+ * @param out The outfile.
+ * @param len Bytes in the pipe.
+ * @return 0 on success, -1 on error.
+ */
+static int	copy_drain(int pipe_rd, int out, ssize_t len)
+{
+	ssize_t	n;
+
+	while (len > 0)
+	{
+		n = splice(pipe_rd, NULL, out, NULL, len, SPLICE_F_MOVE);
+		if (n < 0 && errno == EINTR)
+			continue ;
+		if (n <= 0)
+			return (-1);
+		len -= n;
+	}
+	return (0);
+}
+
+/**
+ * @brief Copies any input to a file or pipe through a pipe with splice,
+ * so the bytes never reach user space.
+ *
+ * @param in The infile.
+ * @param out The outfile.
+ * @return 0 on success, -1 on error, -2 if the first splice is refused.
+ */
+static int	copy_splice(int in, int out)
+{
+	int		fds[2];
+	ssize_t	chunk;
+	ssize_t	n;
+	int		status;
+
+	if (pipe2(fds, O_CLOEXEC) < 0)
+		return (-2);
+	chunk = fcntl(fds[1], F_SETPIPE_SZ, COPY_PIPE);
+	if (chunk <= 0)
+		chunk = fcntl(fds[1], F_GETPIPE_SZ);
+	status = -2;
+	n = 1;
+	while (n > 0 || (n < 0 && errno == EINTR))
+	{
+		n = splice(in, NULL, fds[1], NULL, chunk, SPLICE_F_MOVE);
+		if (n >= 0)
+			status = -1;
+		if (n > 0 && copy_drain(fds[0], out, n) < 0)
+			break ;
+	}
+	close(fds[0]);
+	close(fds[1]);
+	if (n == 0)
+		return (0);
+	return (status);
+}
+
+int	copy_passthrough(t_pipex *pipex)
+{
+	struct stat	in;
+	struct stat	out;
+	int			status;
+
+	if (!pipex->passthrough || fstat(pipex->in_fd, &in) < 0
+		|| fstat(pipex->out_fd, &out) < 0)
+		return (0);
+	status = -2;
+	if (S_ISREG(in.st_mode) && S_ISREG(out.st_mode) && in.st_size > 0
+		&& ioctl(pipex->out_fd, FICLONE, pipex->in_fd) == 0)
+		status = 0;
+	else if (S_ISREG(in.st_mode) && S_ISREG(out.st_mode))
+		status = copy_range(pipex->in_fd, pipex->out_fd, in.st_size);
+	if (status == -2 && (S_ISREG(out.st_mode) || S_ISFIFO(out.st_mode))
+		&& lseek(pipex->in_fd, 0, SEEK_SET) <= 0)
+		status = copy_splice(pipex->in_fd, pipex->out_fd);
+	if (status == -2)
+		return (0);
+	if (status < 0)
+		pipex->copy_status = bi_fail("cat", "write error");
+	return (1);
+}
+
+int	copy_append(int in, int out)
+{
+	ssize_t	n;
+
+	if (lseek(in, 0, SEEK_SET) < 0)
+		return (-1);
+	n = 1;
+	while (n > 0)
+		n = copy_file_range(in, NULL, out, NULL, COPY_CHUNK, 0);
+	if (n == 0)
+		return (0);
+	if (errno != EXDEV && errno != EINVAL && errno != ENOSYS
+		&& errno != EOPNOTSUPP)
+		return (-1);
+	return (-(copy_splice(in, out) != 0));
+}
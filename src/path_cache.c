@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   path_cache.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:18:04 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/17 23:24:00 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+uint64_t	fnv1a(const char *str, size_t len)
+{
+	uint64_t	hash;
+	size_t		i;
+
+	hash = 1469598103934665603ULL;
+	i = 0;
+	while (i < len)
+	{
+		hash ^= (unsigned char)str[i++];
+		hash *= 1099511628211ULL;
+	}
+	if (hash == 0)
+		hash = 1;
+	return (hash);
+}
+
+/**
+ * @brief Returns the slot holding name, or the empty slot where it goes.
+ *
+ * @param pc The path cache.
+ * @param name Command name.
+ * @param hash Hash of the command name.
+ * @return The slot, or NULL if the table is full.
+ */
+static t_pcache_slot	*find_slot(t_pcache *pc, const char *name,
+	uint64_t hash)
+{
+	t_pcache_slot	*slot;
+	size_t			i;
+	size_t			probes;
+
+	i = hash % PCACHE_SLOTS;
+	probes = 0;
+	while (probes++ < PCACHE_SLOTS)
+	{
+		slot = &pc->slots[i];
+		if (slot->hash == 0 || (slot->hash == hash
+				&& !ft_strncmp(slot->name, name, PCACHE_NAME)))
+			return (slot);
+		i = (i + 1) % PCACHE_SLOTS;
+	}
+	return (NULL);
+}
+
+char	*pcache_lookup(t_pcache *pc, const char *name)
+{
+	t_pcache_slot	*slot;
+
+	if (!pc->hdr || ft_strlen(name) >= PCACHE_NAME)
+		return (NULL);
+	slot = find_slot(pc, name, fnv1a(name, ft_strlen(name)));
+	if (!slot || slot->hash == 0)
+		return (NULL);
+	return (slot->path);
+}
+
+void	pcache_insert(t_pcache *pc, const char *name, const char *path)
+{
+	t_pcache_slot	*slot;
+
+	if (!pc->hdr || ft_strlen(name) >= PCACHE_NAME
+		|| ft_strlen(path) >= PCACHE_PATH)
+		return ;
+	if (pc->hdr->used >= PCACHE_SLOTS / 4 * 3)
+	{
+		ft_bzero(pc->slots, sizeof(t_pcache_slot) * PCACHE_SLOTS);
+		pc->hdr->used = 0;
+	}
+	slot = find_slot(pc, name, fnv1a(name, ft_strlen(name)));
+	if (!slot)
+		return ;
+	if (slot->hash == 0)
+		pc->hdr->used++;
+	slot->hash = fnv1a(name, ft_strlen(name));
+	ft_strlcpy(slot->name, name, PCACHE_NAME);
+	ft_strlcpy(slot->path, path, PCACHE_PATH);
+	pc->dirty = 1;
+}
+
+char	*pcache_resolve(t_pcache *pc, char **paths, char *cmd, char *buf)
+{
+	char	*path;
+
+	path = pcache_lookup(pc, cmd);
+	if (path)
+		return (path);
+	path = find_command_path(paths, cmd, buf);
+	if (path)
+		pcache_insert(pc, cmd, path);
+	return (path);
+}
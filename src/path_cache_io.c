@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   path_cache_io.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:18:04 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:24:13 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Picks the cache file: --path-cache=FILE, else
+ * $XDG_CACHE_HOME/pipex-paths, else $HOME/.cache/pipex-paths.
+ *
+ * @param pc The path cache.
+ * @param file Value of --path-cache, or NULL.
+ * @return 0 on success, -1 if no location is available.
+ */
+static int	cache_file(t_pcache *pc, char *file)
+{
+	char	*dir;
+	int		len;
+
+	if (file)
+		len = snprintf(pc->file, sizeof(pc->file), "%s", file);
+	else if (getenv("XDG_CACHE_HOME") && *getenv("XDG_CACHE_HOME"))
+		len = snprintf(pc->file, sizeof(pc->file), "%s/pipex-paths",
+				getenv("XDG_CACHE_HOME"));
+	else
+	{
+		dir = getenv("HOME");
+		if (!dir || !*dir)
+			return (-1);
+		len = snprintf(pc->file, sizeof(pc->file), "%s/.cache", dir);
+		if (len < (int) sizeof(pc->file))
+			mkdir(pc->file, 0700);
+		len = snprintf(pc->file, sizeof(pc->file), "%s/.cache/pipex-paths",
+				dir);
+	}
+	return (-(len >= (int) sizeof(pc->file)));
+}
+
+/**
+ * @brief Maps the cache file privately if it is ours and still valid.
+ *
+ * The file must belong to the current user and not be writable by
+ * others, and its header must match PATH and every directory mtime.
+ *
+ * @param pc The path cache.
+ * @return 0 if the mapping is valid, -1 otherwise.
+ */
+static int	map_cache(t_pcache *pc)
+{
+	struct stat	st;
+	void		*map;
+	int			fd;
+
+	fd = open(pc->file, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return (-1);
+	map = MAP_FAILED;
+	if (fstat(fd, &st) == 0 && (size_t)st.st_size == pc->size
+		&& st.st_uid == getuid() && !(st.st_mode & 022))
+		map = mmap(NULL, pc->size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+				fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+		return (-1);
+	pc->hdr = map;
+	pc->mapped = 1;
+	if (!ft_memcmp(pc->hdr, &pc->want, offsetof(t_pcache_hdr, used)))
+		return (0);
+	munmap(map, pc->size);
+	pc->hdr = NULL;
+	pc->mapped = 0;
+	return (-1);
+}
+
+int	pcache_fill_header(t_pcache *pc, const char *path_env, char **paths)
+{
+	struct stat	st;
+	size_t		i;
+
+	ft_bzero(&pc->want, sizeof(pc->want));
+	pc->want.magic = PCACHE_MAGIC;
+	pc->want.nslots = PCACHE_SLOTS;
+	pc->want.path_len = ft_strlen(path_env);
+	pc->want.path_hash = fnv1a(path_env, pc->want.path_len);
+	i = 0;
+	while (paths[i])
+	{
+		if (i >= PCACHE_DIRS)
+			return (-1);
+		if (stat(paths[i], &st) == 0)
+		{
+			pc->want.mtime_sec[i] = st.st_mtim.tv_sec;
+			pc->want.mtime_nsec[i] = st.st_mtim.tv_nsec;
+		}
+		i++;
+	}
+	pc->want.ndirs = i;
+	return (0);
+}
+
+int	pcache_open(t_pcache *pc, t_pipex *pipex, char *path_env, char **paths)
+{
+	ft_bzero(pc, sizeof(*pc));
+	pc->size = sizeof(t_pcache_hdr) + sizeof(t_pcache_slot) * PCACHE_SLOTS;
+	if (!pipex->opts.path_cache || cache_file(pc, pipex->opts.path_cache_file)
+		|| pcache_fill_header(pc, path_env, paths))
+		return (-1);
+	if (map_cache(pc) < 0)
+	{
+		pc->hdr = ft_calloc(1, pc->size);
+		if (!pc->hdr)
+			return (-1);
+		ft_memcpy(pc->hdr, &pc->want, sizeof(t_pcache_hdr));
+	}
+	pc->slots = (t_pcache_slot *)(pc->hdr + 1);
+	return (0);
+}
@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   path_cache_save.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:24:13 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:24:13 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Atomically replaces the cache file with the in-memory table.
+ *
+ * @param pc The path cache.
+ */
+static void	pcache_save(t_pcache *pc)
+{
+	char	tmp[PATH_MAX + 16];
+	int		fd;
+
+	if (snprintf(tmp, sizeof(tmp), "%s.%d", pc->file, getpid())
+		>= (int) sizeof(tmp))
+		return ;
+	fd = open(tmp, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+	if (fd < 0)
+		return ;
+	if (write(fd, pc->hdr, pc->size) != (ssize_t)pc->size)
+	{
+		close(fd);
+		unlink(tmp);
+		return ;
+	}
+	close(fd);
+	if (rename(tmp, pc->file) < 0)
+		unlink(tmp);
+}
+
+void	pcache_close(t_pcache *pc)
+{
+	if (!pc->hdr)
+		return ;
+	if (pc->dirty)
+		pcache_save(pc);
+	if (pc->mapped)
+		munmap(pc->hdr, pc->size);
+	else
+		free(pc->hdr);
+	pc->hdr = NULL;
+	pc->slots = NULL;
+}
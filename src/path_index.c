@@ -0,0 +1,160 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   path_index.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:20:14 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:25:28 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Returns the slot holding name, or the empty slot where it goes.
+ *
+ * @param idx The PATH index.
+ * @param name Entry name.
+ * @param hash Hash of the entry name.
+ * @return The slot.
+ */
+static t_pidx_slot	*pidx_slot(t_pathidx *idx, const char *name,
+	uint64_t hash)
+{
+	size_t	i;
+
+	i = hash & (idx->cap - 1);
+	while (idx->slots[i].hash && (idx->slots[i].hash != hash
+			|| ft_strncmp(idx->pool + idx->slots[i].off, name, NAME_MAX + 1)))
+		i = (i + 1) & (idx->cap - 1);
+	return (&idx->slots[i]);
+}
+
+/**
+ * @brief Doubles the slot table and reinserts every entry.
+ *
+ * @param idx The PATH index.
+ * @return 0 on success, -1 on allocation failure.
+ */
+static int	pidx_grow(t_pathidx *idx)
+{
+	t_pidx_slot	*old;
+	size_t		old_cap;
+	size_t		i;
+
+	old = idx->slots;
+	old_cap = idx->cap;
+	idx->cap = old_cap * 2;
+	if (!idx->cap)
+		idx->cap = PIDX_SLOTS;
+	idx->slots = ft_calloc(idx->cap, sizeof(t_pidx_slot));
+	if (!idx->slots)
+	{
+		idx->slots = old;
+		idx->cap = old_cap;
+		return (-1);
+	}
+	i = 0;
+	while (i < old_cap)
+	{
+		if (old[i].hash)
+			*pidx_slot(idx, idx->pool + old[i].off, old[i].hash) = old[i];
+		i++;
+	}
+	free(old);
+	return (0);
+}
+
+/**
+ * @brief Adds a directory entry unless an earlier PATH entry has it.
+ *
+ * @param idx The PATH index.
+ * @param name Entry name.
+ * @param dir Index of the PATH directory holding it.
+ * @return 0 on success, -1 on allocation failure.
+ */
+static int	pidx_add(t_pathidx *idx, const char *name, int dir)
+{
+	t_pidx_slot	*slot;
+	uint64_t	hash;
+	size_t		len;
+
+	if (idx->used * 2 >= idx->cap && pidx_grow(idx) < 0)
+		return (-1);
+	len = ft_strlen(name);
+	hash = fnv1a(name, len);
+	slot = pidx_slot(idx, name, hash);
+	if (slot->hash)
+		return (0);
+	if (pidx_pool(idx, len) < 0)
+		return (-1);
+	ft_memcpy(idx->pool + idx->pool_len, name, len + 1);
+	slot->hash = hash;
+	slot->off = idx->pool_len;
+	slot->dir = dir;
+	idx->pool_len += len + 1;
+	idx->used++;
+	return (0);
+}
+
+/**
+ * @brief Reads a PATH directory with getdents64 into the index.
+ *
+ * Subdirectories and dot files are skipped; whether an entry is really
+ * executable is checked later, only for the commands being run.
+ *
+ * @param idx The PATH index.
+ * @param dir Index of the PATH directory.
+ * @return 0 on success, -1 on allocation failure.
+ */
+static int	pidx_scan(t_pathidx *idx, int dir)
+{
+	char			buf[PIDX_DENTS];
+	struct dirent64	*ent;
+	ssize_t			len;
+	ssize_t			pos;
+
+	len = getdents64(idx->fds[dir], buf, sizeof(buf));
+	while (len > 0)
+	{
+		pos = 0;
+		while (pos < len)
+		{
+			ent = (struct dirent64 *)(buf + pos);
+			if (ent->d_name[0] != '.' && ent->d_type != DT_DIR
+				&& pidx_add(idx, ent->d_name, dir) < 0)
+				return (-1);
+			pos += ent->d_reclen;
+		}
+		len = getdents64(idx->fds[dir], buf, sizeof(buf));
+	}
+	return (0);
+}
+
+int	pidx_build(t_pipex *pipex, char **paths)
+{
+	t_pathidx	*idx;
+	int			count;
+
+	idx = &pipex->pidx;
+	if (idx->fds)
+		return (0);
+	count = 0;
+	while (paths[count])
+		count++;
+	idx->fds = malloc(sizeof(int) * (count + 1));
+	if (!idx->fds)
+		return (-1);
+	while (idx->ndirs < count)
+	{
+		idx->fds[idx->ndirs] = open(paths[idx->ndirs],
+				O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+		idx->ndirs++;
+		if (idx->fds[idx->ndirs - 1] >= 0
+			&& pidx_scan(idx, idx->ndirs - 1) < 0)
+			return (-1);
+	}
+	return (0);
+}
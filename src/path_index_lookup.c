@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   path_index_lookup.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:20:14 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:25:28 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Returns the first PATH directory with an entry named cmd.
+ *
+ * @param idx The PATH index.
+ * @param cmd Command name.
+ * @return The directory index, or ndirs if no directory has it.
+ */
+static int	pidx_first(t_pathidx *idx, char *cmd)
+{
+	t_pidx_slot	*slot;
+	uint64_t	hash;
+	size_t		i;
+
+	hash = fnv1a(cmd, ft_strlen(cmd));
+	i = hash & (idx->cap - 1);
+	while (idx->cap && idx->slots[i].hash)
+	{
+		slot = &idx->slots[i];
+		if (slot->hash == hash && !ft_strncmp(idx->pool + slot->off, cmd,
+				NAME_MAX + 1))
+			return (slot->dir);
+		i = (i + 1) & (idx->cap - 1);
+	}
+	return (idx->ndirs);
+}
+
+/**
+ * @brief Finds the first PATH directory holding an executable cmd.
+ *
+ * The index gives the first directory with an entry of that name; if
+ * it is not executable there, the later directories are probed with
+ * faccessat, as a plain PATH search would do.
+ *
+ * @param idx The PATH index.
+ * @param cmd Command name.
+ * @return The directory index, or -1 if the command was not found.
+ */
+static int	pidx_find(t_pathidx *idx, char *cmd)
+{
+	int	dir;
+
+	dir = pidx_first(idx, cmd);
+	while (dir < idx->ndirs)
+	{
+		if (idx->fds[dir] >= 0 && !faccessat(idx->fds[dir], cmd, X_OK, 0))
+			return (dir);
+		dir++;
+	}
+	return (-1);
+}
+
+char	*pidx_resolve(t_pipex *pipex, char **paths, int i, char *buf)
+{
+	int	dir;
+
+	dir = pidx_find(&pipex->pidx, pipex->cmd_args[i][0]);
+	pipex->cmd_dirs[i] = dir;
+	if (dir < 0)
+		return (NULL);
+	return (join_path_cmd(paths[dir], pipex->cmd_args[i][0], buf));
+}
+
+int	pidx_exec_fd(t_pipex *pipex)
+{
+	char	magic[2];
+	int		dirfd;
+	int		fd;
+
+	dirfd = pipex->pidx.fds[pipex->cmd_dirs[pipex->idx]];
+	fd = openat(dirfd, pipex->cmd_args[pipex->idx][0], O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return (openat(dirfd, pipex->cmd_args[pipex->idx][0],
+				O_PATH | O_CLOEXEC));
+	if (read(fd, magic, 2) == 2 && magic[0] == '#' && magic[1] == '!')
+		fcntl(fd, F_SETFD, 0);
+	return (fd);
+}
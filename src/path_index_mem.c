@@ -0,0 +1,52 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   path_index_mem.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:25:28 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:25:28 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+int	pidx_pool(t_pathidx *idx, size_t len)
+{
+	char	*pool;
+
+	if (idx->pool_len + len + 1 <= idx->pool_cap)
+		return (0);
+	pool = malloc(idx->pool_cap * 2 + len + 1);
+	if (!pool)
+		return (-1);
+	ft_memcpy(pool, idx->pool, idx->pool_len);
+	free(idx->pool);
+	idx->pool = pool;
+	idx->pool_cap = idx->pool_cap * 2 + len + 1;
+	return (0);
+}
+
+void	pidx_free_table(t_pathidx *idx)
+{
+	free(idx->slots);
+	free(idx->pool);
+	idx->slots = NULL;
+	idx->pool = NULL;
+	idx->cap = 0;
+	idx->used = 0;
+	idx->pool_len = 0;
+	idx->pool_cap = 0;
+}
+
+void	pidx_free(t_pipex *pipex)
+{
+	pidx_free_table(&pipex->pidx);
+	while (pipex->pidx.ndirs > 0)
+		safe_close(&pipex->pidx.fds[--pipex->pidx.ndirs]);
+	free(pipex->pidx.fds);
+	pipex->pidx.fds = NULL;
+	free(pipex->cmd_dirs);
+	pipex->cmd_dirs = NULL;
+}
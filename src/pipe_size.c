@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipe_size.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:56:57 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:59:40 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Returns /proc/sys/fs/pipe-max-size, read once.
+ *
+ * @return The largest pipe capacity to ask for.
+ */
+static int	pipe_max(void)
+{
+	static int	max;
+	char		buf[32];
+	ssize_t		len;
+	int			fd;
+
+	if (max > 0)
+		return (max);
+	fd = open(PIPE_MAX_FILE, O_RDONLY | O_CLOEXEC);
+	len = -1;
+	if (fd >= 0)
+		len = read(fd, buf, sizeof(buf) - 1);
+	if (fd >= 0)
+		close(fd);
+	if (len > 0)
+	{
+		buf[len] = '\0';
+		max = ft_atoi(buf);
+	}
+	if (max <= 0)
+		max = COPY_PIPE;
+	return (max);
+}
+
+/**
+ * @brief Returns the --pipe-size of the pipe in front of a stage.
+ *
+ * A size given for the stage's own number wins over one given for
+ * every pipe; the last one given wins among equals.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param i Index of the stage reading the pipe.
+ * @return The capacity in bytes, or 0 to keep the default.
+ */
+static size_t	pipe_wanted(t_pipex *pipex, int i)
+{
+	t_pipesz	*sz;
+	size_t		all;
+	size_t		own;
+	int			k;
+
+	all = 0;
+	own = 0;
+	k = -1;
+	while (++k < pipex->opts.pipe_sz_count)
+	{
+		sz = &pipex->opts.pipe_sz[k];
+		if (sz->stage == i + 1)
+			own = sz->bytes;
+		else if (sz->stage == 0)
+			all = sz->bytes;
+	}
+	if (own > 0)
+		return (own);
+	return (all);
+}
+
+void	size_stage_pipe(t_pipex *pipex)
+{
+	t_stage	*st;
+	size_t	want;
+	int		fd;
+
+	st = &pipex->stages[pipex->idx + 1];
+	fd = pipex->pipe_fd[0];
+	want = pipe_wanted(pipex, pipex->idx + 1);
+	if (want > (size_t)pipe_max())
+		want = pipe_max();
+	if (want > 0)
+		fcntl(fd, F_SETPIPE_SZ, (int)want);
+	if (!want && !pipex->opts.pipe_auto && pipex->opts.stats == STATS_NONE)
+		return ;
+	st->pipe_size = fcntl(fd, F_GETPIPE_SZ);
+	if (pipex->opts.pipe_auto && pipex->idx < PIPE_AUTO_FDS)
+		st->pipe_rd = fcntl(fd, F_DUPFD_CLOEXEC, 3);
+}
+
+/**
+ * @brief Doubles the capacity of a stage's input pipe, up to the
+ * maximum.
+ *
+ * @param st The stage.
+ */
+static void	pipe_grow(t_stage *st)
+{
+	int	size;
+
+	size = st->pipe_size * 2;
+	if (size > pipe_max())
+		size = pipe_max();
+	size = fcntl(st->pipe_rd, F_SETPIPE_SZ, size);
+	if (size <= st->pipe_size)
+		return ;
+	st->pipe_size = size;
+	st->pipe_grows++;
+}
+
+int	pipe_sample(t_pipex *pipex, struct timespec *at, struct timespec *now)
+{
+	t_stage	*st;
+	int		queued;
+	int		i;
+
+	if ((at->tv_sec || at->tv_nsec) && elapsed_ms(now, at) > 0)
+		return (1);
+	*at = *now;
+	ts_add_ms(at, PIPE_SAMPLE_MS);
+	i = 0;
+	while (++i < pipex->cmd_count)
+	{
+		st = &pipex->stages[i];
+		if (st->pipe_rd >= 0 && st->pipe_size < pipe_max()
+			&& ioctl(st->pipe_rd, FIONREAD, &queued) == 0
+			&& queued >= st->pipe_size / 4 * 3)
+			pipe_grow(st);
+	}
+	return (1);
+}
@@ -1,38 +1,47 @@
-/* ************************************************************************** */
-/*                                                                            */
-/*                                                        :::      ::::::::   */
-/*   pipes.c                                            :+:      :+:    :+:   */
-/*                                                    +:+ +:+         +:+     */
-/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
-/*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2025/07/10 13:16:17 by dancuenc          #+#    #+#             */
-/*   Updated: 2025/07/10 13:21:30 by dancuenc         ###   ########.fr       */
-/*                                                                            */
-/* ************************************************************************** */
-
 #include "../include/pipex.h"
 
-void	create_pipes(t_pipex *pipex)
+int	open_stage_pipe(t_pipex *pipex)
 {
-	int	i;
-
-	i = 0;
-	while (i < pipex->cmd_count - 1)
+	if (pipex->idx >= pipex->cmd_count - 1)
+		return (0);
+	if (pipe2(pipex->pipe_fd, O_CLOEXEC) < 0)
 	{
-		if (pipe(pipex->pipes + 2 * i) < 0)
-			parent_free(pipex);
-		i++;
+		handle_error(ERR_PIPE);
+		pipex->pipe_fd[0] = -1;
+		pipex->pipe_fd[1] = -1;
+		return (1);
 	}
+	size_stage_pipe(pipex);
+	return (0);
+}
+
+void	advance_pipes(t_pipex *pipex)
+{
+	safe_close(&pipex->prev_fd);
+	safe_close(&pipex->pipe_fd[1]);
+	if (pipex->idx == 0 && pipex->heredoc_pid > 0)
+		safe_close(&pipex->in_fd);
+	pipex->prev_fd = pipex->pipe_fd[0];
+	pipex->pipe_fd[0] = -1;
 }
 
 void	close_pipes(t_pipex *pipex)
 {
-	int	i;
+	safe_close(&pipex->prev_fd);
+	safe_close(&pipex->pipe_fd[0]);
+	safe_close(&pipex->pipe_fd[1]);
+}
+
+int	stage_in_fd(t_pipex *pipex)
+{
+	if (pipex->idx == 0)
+		return (pipex->in_fd);
+	return (pipex->prev_fd);
+}
 
-	i = 0;
-	while (i < (pipex->pipe_count))
-	{
-		close(pipex->pipes[i]);
-		i++;
-	}
+int	stage_out_fd(t_pipex *pipex)
+{
+	if (pipex->idx == pipex->cmd_count - 1)
+		return (pipex->out_fd);
+	return (pipex->pipe_fd[1]);
 }
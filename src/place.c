@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   place.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:01:02 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:01:02 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Reads a number from a file under a CPU's sysfs directory.
+ *
+ * @param cpu The CPU.
+ * @param leaf Path below /sys/devices/system/cpu/cpuN.
+ * @return The number, or -1 if the file cannot be read.
+ */
+static long long	cpu_sys(int cpu, const char *leaf)
+{
+	char	path[128];
+	char	buf[32];
+	ssize_t	len;
+	int		fd;
+
+	snprintf(path, sizeof(path), CPU_SYS, cpu, leaf);
+	fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return (-1);
+	len = read(fd, buf, sizeof(buf) - 1);
+	close(fd);
+	if (len <= 0)
+		return (-1);
+	buf[len] = '\0';
+	return (ft_atoi(buf));
+}
+
+/**
+ * @brief Builds the sort key of a CPU: package, L3 domain, core, CPU.
+ *
+ * Without an L3 cache the package is the domain. Bits 32 and up name
+ * the domain.
+ *
+ * @param cpu The CPU.
+ * @return The key.
+ */
+static long long	cpu_key(int cpu)
+{
+	long long	pkg;
+	long long	l3;
+	long long	core;
+
+	pkg = cpu_sys(cpu, "topology/physical_package_id");
+	l3 = cpu_sys(cpu, "cache/index3/id");
+	core = cpu_sys(cpu, "topology/core_id");
+	if (l3 < 0)
+		l3 = pkg;
+	return (((pkg & 0xffff) << 48) | ((l3 & 0xffff) << 32)
+		| ((core & 0xffff) << 16) | (cpu & 0xffff));
+}
+
+/**
+ * @brief Sorts the CPUs by key, with an insertion sort, as there are
+ * at most CPU_SETSIZE of them and the list is nearly sorted already.
+ *
+ * @param pl The placement.
+ */
+static void	place_sort(t_place *pl)
+{
+	long long	key;
+	int			cpu;
+	int			i;
+	int			j;
+
+	i = 0;
+	while (++i < pl->count)
+	{
+		key = pl->keys[i];
+		cpu = pl->cpus[i];
+		j = i;
+		while (j > 0 && pl->keys[j - 1] > key)
+		{
+			pl->keys[j] = pl->keys[j - 1];
+			pl->cpus[j] = pl->cpus[j - 1];
+			j--;
+		}
+		pl->keys[j] = key;
+		pl->cpus[j] = cpu;
+	}
+}
+
+/**
+ * @brief Collects the CPUs that share the L3 domain of the first one.
+ *
+ * @param pl The placement, sorted.
+ */
+static void	place_domain(t_place *pl)
+{
+	int	i;
+
+	CPU_ZERO(&pl->domain);
+	i = -1;
+	while (++i < pl->count)
+	{
+		if (pl->keys[i] >> 32 == pl->keys[0] >> 32)
+			CPU_SET(pl->cpus[i], &pl->domain);
+	}
+}
+
+void	place_init(t_pipex *pipex)
+{
+	cpu_set_t	allowed;
+	t_place		*pl;
+	int			cpu;
+
+	pl = &pipex->place;
+	if (pipex->opts.pin == PIN_NONE
+		|| sched_getaffinity(0, sizeof(allowed), &allowed) < 0)
+		return ;
+	pl->cpus = arena_alloc(&pipex->arena, sizeof(int) * CPU_SETSIZE);
+	pl->keys = arena_alloc(&pipex->arena, sizeof(long long) * CPU_SETSIZE);
+	if (!pl->cpus || !pl->keys)
+		return ;
+	cpu = -1;
+	while (++cpu < CPU_SETSIZE)
+	{
+		if (!CPU_ISSET(cpu, &allowed))
+			continue ;
+		pl->keys[pl->count] = cpu_key(cpu);
+		pl->cpus[pl->count++] = cpu;
+	}
+	place_sort(pl);
+	place_domain(pl);
+}
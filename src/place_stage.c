@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   place_stage.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:01:02 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:01:02 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Looks up a per-stage setting for the current stage.
+ *
+ * A setting given for the stage's own number wins over one given for
+ * every stage; the last one given wins among equals.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param kind PLACE_SCHED, PLACE_NICE or PLACE_IOPRIO.
+ * @param value Receives the setting.
+ * @return 1 if the stage has one, 0 otherwise.
+ */
+static int	place_value(t_pipex *pipex, int kind, int *value)
+{
+	t_stageplace	*pl;
+	int				found;
+	int				k;
+
+	found = 0;
+	k = -1;
+	while (++k < pipex->opts.place_count)
+	{
+		pl = &pipex->opts.place[k];
+		if (pl->kind != kind || (pl->stage && pl->stage != pipex->idx + 1)
+			|| (found == 2 && !pl->stage))
+			continue ;
+		*value = pl->value;
+		found = 1 + (pl->stage != 0);
+	}
+	return (found != 0);
+}
+
+/**
+ * @brief Restricts the stage to its CPU, or to the L3 domain.
+ *
+ * @param pipex Pointer to the pipex struct.
+ */
+static void	place_cpus(t_pipex *pipex)
+{
+	cpu_set_t	set;
+
+	if (pipex->place.count == 0)
+		return ;
+	if (pipex->opts.pin == PIN_DOMAIN)
+		set = pipex->place.domain;
+	else
+	{
+		CPU_ZERO(&set);
+		CPU_SET(pipex->place.cpus[pipex->idx % pipex->place.count], &set);
+	}
+	if (sched_setaffinity(0, sizeof(set), &set) < 0)
+		bi_fail("pipex", "affinity");
+}
+
+void	place_stage(t_pipex *pipex)
+{
+	struct sched_param	param;
+	int					value;
+
+	if (!pipex->opts.placed)
+		return ;
+	place_cpus(pipex);
+	ft_bzero(&param, sizeof(param));
+	if (place_value(pipex, PLACE_SCHED, &value)
+		&& sched_setscheduler(0, value, &param) < 0)
+		bi_fail("pipex", "sched");
+	if (place_value(pipex, PLACE_NICE, &value)
+		&& setpriority(PRIO_PROCESS, 0, value) < 0)
+		bi_fail("pipex", "nice");
+	if (place_value(pipex, PLACE_IOPRIO, &value)
+		&& syscall(SYS_ioprio_set, IOPRIO_WHO_PROCESS, 0, value) < 0)
+		bi_fail("pipex", "ioprio");
+}
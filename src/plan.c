@@ -0,0 +1,153 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   plan.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:38:33 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 00:43:59 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Checks whether stage i is a single command with this name.
+ *
+ * @param p The plan.
+ * @param i The stage.
+ * @param name The command name.
+ * @return 1 if it is, 0 otherwise.
+ */
+static int	plan_is(t_plan *p, int i, const char *name)
+{
+	return (p->fused[i] == 1 && p->args[i][0]
+		&& !ft_strncmp(p->args[i][0], name, ft_strlen(name) + 1));
+}
+
+/**
+ * @brief Drops every cat stage that only copies its input, so that the
+ * next stage reads the infile, or the previous stage's pipe, itself.
+ *
+ * @param p The plan.
+ */
+static void	rule_cat(t_plan *p)
+{
+	const char	*rule;
+	const char	*why;
+	int			seen;
+	int			i;
+
+	seen = 0;
+	i = -1;
+	while (++i < p->count)
+	{
+		if (!plan_is(p, i, "cat"))
+			continue ;
+		seen = 1;
+		why = plan_cat(p, i, &rule);
+		if (why)
+			plan_log(p, rule, 0, "command %d: %s", p->orig[i], why);
+		if (why)
+			continue ;
+		plan_log(p, rule, 1, "command %d reads the input of command %d "
+			"directly", p->orig[i + 1], p->orig[i]);
+		plan_drop(p, i--);
+	}
+	if (!seen)
+		plan_log(p, "drop-cat", 0, "no cat stage");
+}
+
+/**
+ * @brief Turns sort | head -n K into the top-K builtin, which keeps K
+ * lines in a heap instead of sorting all of its input.
+ *
+ * @param p The plan.
+ */
+static void	rule_topk(t_plan *p)
+{
+	const char	*why;
+	int			seen;
+	int			i;
+
+	seen = 0;
+	i = -1;
+	while (++i < p->count)
+	{
+		if (!plan_is(p, i, "sort"))
+			continue ;
+		seen = 1;
+		why = plan_topk(p, i);
+		if (why)
+			plan_log(p, "top-k", 0, "command %d: %s", p->orig[i], why);
+		if (why)
+			continue ;
+		plan_log(p, "top-k", 1, "commands %d and %d keep only the lines "
+			"head prints", p->orig[i], p->orig[i + 1]);
+		if (plan_join(p, i) < 0)
+			return ;
+	}
+	if (!seen)
+		plan_log(p, "top-k", 0, "no sort stage");
+}
+
+/**
+ * @brief Joins each run of adjacent tr, head and cat stages into one
+ * stage that passes every block through all of them in turn.
+ *
+ * @param p The plan.
+ */
+static void	rule_fuse(t_plan *p)
+{
+	const char	*why;
+	int			i;
+	int			k;
+
+	if (!p->builtins)
+		plan_log(p, "fuse", 0, "builtins are disabled");
+	else if (p->count < 2)
+		plan_log(p, "fuse", 0, "only one stage");
+	i = 0;
+	while (p->builtins && i + 1 < p->count)
+	{
+		k = i + (plan_filter(p, i) == NULL);
+		why = plan_filter(p, k);
+		if (why)
+		{
+			plan_log(p, "fuse", 0, "command %d: %s", p->orig[k], why);
+			i = k + 1;
+			continue ;
+		}
+		plan_log(p, "fuse", 1, "command %d joins the block loop of "
+			"command %d", p->orig[i + 1], p->orig[i]);
+		if (plan_join(p, i) < 0)
+			return ;
+	}
+}
+
+void	plan_optimize(t_pipex *pipex, int infile_ok)
+{
+	t_plan		p;
+	const char	*why;
+
+	if (plan_init(&p, pipex) < 0)
+		return ;
+	p.infile_ok = infile_ok;
+	plan_print(&p, "original plan:");
+	if (p.explain)
+		dprintf(STDOUT_FILENO, "rules:\n");
+	rule_cat(&p);
+	rule_topk(&p);
+	rule_fuse(&p);
+	why = plan_copy(&p, pipex);
+	pipex->passthrough = !why;
+	if (why)
+		plan_log(&p, "kernel-copy", 0, "%s", why);
+	else
+		plan_log(&p, "kernel-copy", 1, "the infile is copied to the "
+			"outfile by the kernel, with no process");
+	plan_print(&p, "optimized plan:");
+	pipex->cmd_count = p.count;
+	pipex->cmd_fused = p.fused;
+}
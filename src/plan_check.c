@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   plan_check.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:38:33 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:51:38 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+const char	*plan_cat(t_plan *p, int i, const char **rule)
+{
+	t_bargs	args;
+
+	*rule = "drop-cat";
+	if (i == 0)
+		*rule = "infile-direct";
+	if (p->args[i][1])
+		return ("cat has operands");
+	if (i == p->count - 1)
+		return ("last stage, its exit status is the pipeline's");
+	if (i == 0 && !p->infile_ok)
+		return ("the infile cannot be read, the next command must still run");
+	if (i == 0 && fuse_element(p->args[1], &args))
+		return ("the next command may print differently from a file");
+	return (NULL);
+}
+
+const char	*plan_filter(t_plan *p, int i)
+{
+	t_bargs	args;
+
+	if (fuse_element(p->args[i], &args) || args.kind == FUSE_SORT)
+		return ("not tr, head or cat without operands");
+	return (NULL);
+}
+
+const char	*plan_topk(t_plan *p, int i)
+{
+	t_bargs		args;
+	const char	*collate;
+
+	if (!p->builtins)
+		return ("builtins are disabled");
+	if (i == p->count - 1 || p->fused[i + 1] > 1
+		|| fuse_element(p->args[i + 1], &args) || args.kind != FUSE_HEAD)
+		return ("not followed by a head the builtin takes");
+	if (args.mode != BI_LINES)
+		return ("head counts bytes, not lines");
+	if (p->fused[i] > 1 || fuse_element(p->args[i], &args))
+		return ("only sort -n and -r are supported");
+	collate = bi_locale("LC_COLLATE");
+	if (collate && ft_strncmp(collate, "C", 2)
+		&& ft_strncmp(collate, "POSIX", 6))
+		return ("LC_COLLATE is not C, so sort would not compare bytes");
+	return (NULL);
+}
+
+const char	*plan_copy(t_plan *p, t_pipex *pipex)
+{
+	t_bargs	args;
+
+	if (!p->builtins)
+		return ("builtins are disabled");
+	if (p->count != 1 || p->fused[0] > 1 || fuse_element(p->args[0], &args)
+		|| args.kind != FUSE_CAT)
+		return ("the plan is not a single cat without operands");
+	if (pipex->here_doc)
+		return ("here_doc input is appended, not copied");
+	if (pipex->opts.stats != STATS_NONE)
+		return ("--stats needs a process to measure");
+	return (NULL);
+}
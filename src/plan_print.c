@@ -0,0 +1,83 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   plan_print.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:38:33 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:09:13 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+void	plan_log(t_plan *p, const char *rule, int fired, const char *fmt, ...)
+{
+	va_list	ap;
+
+	if (!p->explain)
+		return ;
+	if (fired)
+		dprintf(STDOUT_FILENO, "  %-14s%-9s", rule, "fired");
+	else
+		dprintf(STDOUT_FILENO, "  %-14s%-9s", rule, "skipped");
+	va_start(ap, fmt);
+	vdprintf(STDOUT_FILENO, fmt, ap);
+	va_end(ap);
+	write(STDOUT_FILENO, "\n", 1);
+}
+
+/**
+ * @brief Prints one stage: its commands joined by " | ", then what the
+ * planner made of it.
+ *
+ * @param p The plan.
+ * @param i The stage.
+ */
+static void	plan_stage(t_plan *p, int i)
+{
+	char	**argv;
+	int		k;
+
+	dprintf(STDOUT_FILENO, "  %d: ", i + 1);
+	argv = p->args[i];
+	k = -1;
+	while (++k < p->fused[i])
+	{
+		if (k > 0)
+			write(STDOUT_FILENO, " | ", 3);
+		write_command(STDOUT_FILENO, argv, 0);
+		while (*argv)
+			argv++;
+		argv++;
+	}
+	if (p->fused[i] > 1 && !ft_strncmp(p->args[i][0], "sort", 5))
+		write(STDOUT_FILENO, "  [top-k builtin]", 17);
+	else if (p->fused[i] > 1)
+		write(STDOUT_FILENO, "  [fused builtin]", 17);
+	if (p->orig[i] != i + 1)
+		dprintf(STDOUT_FILENO, "  (command %d)", p->orig[i]);
+	write(STDOUT_FILENO, "\n", 1);
+}
+
+void	plan_print(t_plan *p, const char *title)
+{
+	int	i;
+
+	if (!p->explain)
+		return ;
+	dprintf(STDOUT_FILENO, "%s\n", title);
+	i = -1;
+	while (++i < p->count)
+		plan_stage(p, i);
+}
+
+int	plan_explain(t_pipex *pipex, int ac, char **av)
+{
+	pipex->cmd_count = ac - 3 - pipex->here_doc;
+	parse_cmds(pipex, av);
+	plan_optimize(pipex, pipex->here_doc || access(av[1], R_OK) == 0);
+	free_parsed(pipex);
+	return (0);
+}
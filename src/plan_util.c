@@ -0,0 +1,89 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   plan_util.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:38:33 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 00:38:33 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Counts the pointers of a stage's argv, its NULLs included but
+ * not the one that ends a fused stage.
+ *
+ * @param argv The stage's argv.
+ * @param n Number of commands in it.
+ * @return The number of pointers.
+ */
+static size_t	plan_width(char **argv, int n)
+{
+	size_t	len;
+
+	len = 0;
+	while (n-- > 0)
+	{
+		while (argv[len])
+			len++;
+		len++;
+	}
+	return (len);
+}
+
+int	plan_init(t_plan *p, t_pipex *pipex)
+{
+	int	i;
+
+	p->args = pipex->cmd_args;
+	p->count = pipex->cmd_count;
+	p->infile_ok = 0;
+	p->builtins = !pipex->opts.no_builtins;
+	p->explain = pipex->opts.explain;
+	p->arena = &pipex->arena;
+	p->fused = arena_alloc(p->arena, sizeof(int) * p->count * 2);
+	if (!p->fused)
+		return (-1);
+	p->orig = p->fused + p->count;
+	i = -1;
+	while (++i < p->count)
+	{
+		p->fused[i] = 1;
+		p->orig[i] = i + 1;
+	}
+	return (0);
+}
+
+void	plan_drop(t_plan *p, int i)
+{
+	ft_memmove(p->args + i, p->args + i + 1,
+		sizeof(char **) * (p->count - i));
+	ft_memmove(p->fused + i, p->fused + i + 1,
+		sizeof(int) * (p->count - i - 1));
+	ft_memmove(p->orig + i, p->orig + i + 1,
+		sizeof(int) * (p->count - i - 1));
+	p->count--;
+}
+
+int	plan_join(t_plan *p, int i)
+{
+	char	**argv;
+	size_t	left;
+	size_t	right;
+
+	left = plan_width(p->args[i], p->fused[i]);
+	right = plan_width(p->args[i + 1], p->fused[i + 1]);
+	argv = arena_alloc(p->arena, sizeof(char *) * (left + right + 1));
+	if (!argv)
+		return (-1);
+	ft_memcpy(argv, p->args[i], sizeof(char *) * left);
+	ft_memcpy(argv + left, p->args[i + 1], sizeof(char *) * right);
+	argv[left + right] = NULL;
+	p->args[i] = argv;
+	p->fused[i] += p->fused[i + 1];
+	plan_drop(p, i + 1);
+	return (0);
+}
@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   resolve.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:21:15 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:09:13 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+char	*find_command_path(char **paths, char *cmd, char *buf)
+{
+	int	j;
+
+	j = 0;
+	while (paths[j])
+	{
+		if (join_path_cmd(paths[j], cmd, buf) && access(buf, X_OK) == 0)
+			return (buf);
+		j++;
+	}
+	return (NULL);
+}
+
+int	resolve_init(t_pipex *pipex)
+{
+	size_t	count;
+
+	count = pipex->cmd_count;
+	pipex->cmd_paths = arena_alloc(&pipex->arena, sizeof(char *) * (count + 1));
+	if (!pipex->cmd_paths)
+		return (-1);
+	ft_bzero(pipex->cmd_paths, sizeof(char *) * (count + 1));
+	if (pipex->opts.path_index && !pipex->opts.lazy_resolve)
+	{
+		pipex->cmd_dirs = malloc(sizeof(int) * (count + 1));
+		if (!pipex->cmd_dirs)
+			return (-1);
+		ft_memset(pipex->cmd_dirs, -1, sizeof(int) * count);
+	}
+	if (pipex->opts.no_builtins)
+		return (0);
+	pipex->cmd_builtin = arena_alloc(&pipex->arena, sizeof(int) * count);
+	if (!pipex->cmd_builtin)
+		return (-1);
+	ft_memset(pipex->cmd_builtin, -1, sizeof(int) * count);
+	return (0);
+}
+
+char	*resolve_command(t_pipex *pipex, char **paths, t_pcache *pc, int i)
+{
+	char	buf[PATH_MAX];
+	char	*cmd;
+	char	*path;
+
+	cmd = pipex->cmd_args[i][0];
+	if (!cmd || cmd[0] == '\0')
+		return (NULL);
+	if (pipex->cmd_builtin)
+		pipex->cmd_builtin[i] = builtin_stage(pipex, i);
+	if (pipex->cmd_builtin && pipex->cmd_builtin[i] >= 0)
+		path = cmd;
+	else if (pipex->cmd_dirs && !ft_strchr(cmd, '/'))
+		path = pidx_resolve(pipex, paths, i, buf);
+	else if (pc && pc->hdr && !ft_strchr(cmd, '/'))
+		path = pcache_resolve(pc, paths, cmd, buf);
+	else if (access(cmd, X_OK) == 0)
+		path = cmd;
+	else
+		path = find_command_path(paths, cmd, buf);
+	if (!path)
+		return (NULL);
+	return (arena_strdup(&pipex->arena, path));
+}
+
+void	resolve_command_paths(t_pipex *pipex, char **paths, t_pcache *pc)
+{
+	int	i;
+
+	i = 0;
+	while (i < pipex->cmd_count)
+	{
+		pipex->cmd_paths[i] = resolve_command(pipex, paths, pc, i);
+		i++;
+	}
+	pipex->cmd_paths[i] = NULL;
+}
+
+void	resolve_in_child(t_pipex *pipex)
+{
+	if (!pipex->opts.lazy_resolve)
+		return ;
+	pipex->cmd_paths[pipex->idx] = resolve_command(pipex, pipex->paths,
+			NULL, pipex->idx);
+}
@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spawn.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:07:41 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:58:02 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Computes the stdin/stdout descriptors of the current stage.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param in Receives the descriptor to dup onto stdin.
+ * @param out Receives the descriptor to dup onto stdout.
+ * @return 0 if the stage can be launched without the fork error path
+ * and runs an external command.
+ */
+static int	stage_io(t_pipex *pipex, int *in, int *out)
+{
+	*in = stage_in_fd(pipex);
+	*out = stage_out_fd(pipex);
+	if (*in < 0 || *out < 0 || !pipex->cmd_paths[pipex->idx]
+		|| (pipex->cmd_builtin && pipex->cmd_builtin[pipex->idx] >= 0))
+		return (1);
+	return (0);
+}
+
+/**
+ * @brief Records the dup2 actions of a stage in a file action list.
+ *
+ * Every other descriptor held by the parent is O_CLOEXEC, so no close
+ * actions are needed.
+ *
+ * @param fa File action list to fill.
+ * @param in Descriptor to dup onto stdin.
+ * @param out Descriptor to dup onto stdout.
+ * @return 0 on success, an error number otherwise.
+ */
+static int	add_file_actions(posix_spawn_file_actions_t *fa, int in, int out)
+{
+	int	ret;
+
+	ret = posix_spawn_file_actions_adddup2(fa, in, STDIN_FILENO);
+	if (!ret)
+		ret = posix_spawn_file_actions_adddup2(fa, out, STDOUT_FILENO);
+	return (ret);
+}
+
+/**
+ * @brief Launches the current stage with posix_spawn.
+ *
+ * posix_spawn reports a failed exec itself, so the stage is not tried
+ * again through fork: the error is printed as the fork path would, the
+ * stage is left without a process and, if it is the last one, the
+ * pipeline exits with 126.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param in Descriptor to dup onto stdin.
+ * @param out Descriptor to dup onto stdout.
+ * @param envp Environment variables.
+ * @return 0 once the stage is handled, 1 if it must go through fork.
+ */
+static int	posix_spawn_stage(t_pipex *pipex, int in, int out, char **envp)
+{
+	posix_spawn_file_actions_t	fa;
+	int							ret;
+
+	if (posix_spawn_file_actions_init(&fa) != 0)
+		return (1);
+	ret = add_file_actions(&fa, in, out);
+	if (!ret)
+		ret = posix_spawn(&pipex->pid, pipex->cmd_paths[pipex->idx], &fa,
+				NULL, pipex->cmd_args[pipex->idx], envp);
+	posix_spawn_file_actions_destroy(&fa);
+	if (!ret)
+		return (0);
+	errno = ret;
+	bi_fail(pipex->cmd_paths[pipex->idx], NULL);
+	pipex->pid = -1;
+	if (pipex->idx == pipex->cmd_count - 1)
+		pipex->copy_status = 126;
+	return (0);
+}
+
+/**
+ * @brief Launches the current stage with vfork.
+ *
+ * The child shares the parent's memory until execve, so it only issues
+ * dup2 and execve. Its error message is formatted beforehand, and a
+ * failed exec writes it and calls _exit.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param in Descriptor to dup onto stdin.
+ * @param out Descriptor to dup onto stdout.
+ * @param envp Environment variables.
+ * @return 0 if the stage was launched, 1 otherwise.
+ */
+static int	vfork_stage(t_pipex *pipex, int in, int out, char **envp)
+{
+	char	msg[PATH_MAX + 32];
+	int		len;
+
+	len = snprintf(msg, sizeof(msg), "%s: %s\n",
+			pipex->cmd_paths[pipex->idx], ERR_EXEC);
+	if (len > (int) sizeof(msg) - 1)
+		len = sizeof(msg) - 1;
+	pipex->pid = vfork();
+	if (pipex->pid == -1)
+		return (1);
+	if (pipex->pid == 0)
+	{
+		redirect_io(in, out);
+		execute_child_command(pipex, envp);
+		write(STDERR_FILENO, msg, len);
+		_exit(126);
+	}
+	return (0);
+}
+
+int	launch_stage(t_pipex *pipex, char **envp)
+{
+	int	in;
+	int	out;
+
+	if (pipex->opts.spawn_mode == SPAWN_FORK || stage_io(pipex, &in, &out))
+		return (1);
+	if (pipex->opts.placed)
+		return (1);
+	if (pipex->opts.spawn_mode == SPAWN_VFORK)
+		return (vfork_stage(pipex, in, out, envp));
+	return (posix_spawn_stage(pipex, in, out, envp));
+}
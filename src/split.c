@@ -0,0 +1,166 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   split.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:12:21 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 02:02:35 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Maps a regular infile to find where to cut it.
+ *
+ * @param infile Path of the infile.
+ * @param size Receives its size.
+ * @return The mapping, or MAP_FAILED if it is not a regular file or
+ * cannot be mapped.
+ */
+static char	*split_map(char *infile, off_t *size)
+{
+	struct stat	st;
+	char		*map;
+	int			fd;
+
+	map = MAP_FAILED;
+	fd = open(infile, O_RDONLY | O_CLOEXEC);
+	if (fd >= 0 && fstat(fd, &st) == 0 && S_ISREG(st.st_mode)
+		&& st.st_size > 0)
+	{
+		*size = st.st_size;
+		map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	}
+	if (fd >= 0)
+		close(fd);
+	return (map);
+}
+
+/**
+ * @brief Returns the first line start at or after at.
+ *
+ * @param map The infile.
+ * @param size Its size.
+ * @param at Where the cut would fall.
+ * @return The offset just past the newline ending the line that holds
+ * byte at - 1, or size if there is none.
+ */
+static off_t	split_align(const char *map, off_t size, off_t at)
+{
+	const char	*nl;
+
+	if (at <= 0 || at >= size)
+		return (at);
+	nl = memchr(map + at - 1, '\n', size - at + 1);
+	if (!nl)
+		return (size);
+	return (nl - map + 1);
+}
+
+/**
+ * @brief Cuts the infile into --split parts of about the same size,
+ * each ending after a newline, at most one per SPLIT_MIN bytes.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param sp The copies, whose parts are allocated here.
+ * @param infile Path of the infile.
+ * @return 0 on success, -1 if the pipeline must run once.
+ */
+static int	split_cuts(t_pipex *pipex, t_split *sp, char *infile)
+{
+	char	*map;
+	off_t	size;
+	int		k;
+
+	map = split_map(infile, &size);
+	if (map == MAP_FAILED)
+		return (-1);
+	sp->count = pipex->opts.split;
+	if (size / SPLIT_MIN < sp->count)
+		sp->count = size / SPLIT_MIN;
+	if (sp->count > 1)
+		sp->parts = ft_calloc(sp->count, sizeof(t_chunk));
+	k = -1;
+	while (sp->parts && ++k < sp->count)
+	{
+		sp->parts[k].end = split_align(map, size, size * (k + 1) / sp->count);
+		if (k > 0)
+			sp->parts[k].start = sp->parts[k - 1].end;
+		sp->parts[k].out = -1;
+		sp->parts[k].pid = -1;
+		sp->parts[k].status = 0;
+	}
+	munmap(map, size);
+	return (-!sp->parts);
+}
+
+/**
+ * @brief Forks one copy of the pipeline per non-empty part. The first
+ * writes to the outfile, the others to anonymous files in the temporary
+ * directory.
+ *
+ * @param pipex Pointer to the pipex struct, with the outfile open.
+ * @param sp The copies.
+ * @param ac Argument count.
+ * @param av Argument vector.
+ */
+static void	split_start(t_pipex *pipex, t_split *sp, int ac, char **av)
+{
+	t_chunk	*part;
+	int		k;
+
+	k = -1;
+	while (++k < sp->count)
+	{
+		part = &sp->parts[k];
+		if (part->start == part->end)
+			continue ;
+		part->out = pipex->out_fd;
+		if (k > 0)
+			part->out = open_anon_file(temp_dir(pipex));
+		if (part->out >= 0)
+			part->pid = fork();
+		if (part->pid == 0)
+		{
+			pipex->chunk = part;
+			exit(run_pipeline(pipex, ac, av, sp->envp));
+		}
+		part->status = 1;
+		if (part->pid > 0)
+			part->status = -1;
+		else
+			handle_error("split");
+	}
+}
+
+int	run_split(t_pipex *pipex, int ac, char **av, char **envp)
+{
+	t_split	sp;
+
+	ft_bzero(&sp, sizeof(sp));
+	sp.envp = envp;
+	load_paths(pipex, envp);
+	if (pipex->here_doc || split_check(pipex, ac, av) < 0
+		|| split_cuts(pipex, &sp, av[1]) < 0)
+		return (run_pipeline(pipex, ac, av, envp));
+	get_outfile(av[ac - 1], pipex);
+	if (pipex->out_fd < 0)
+	{
+		sp.count = 0;
+		sp.status = 1;
+	}
+	split_start(pipex, &sp, ac, av);
+	while (sp.done < sp.count)
+	{
+		if (split_reap(pipex, &sp) < 0)
+			break ;
+	}
+	safe_close(&pipex->out_fd);
+	free(sp.parts);
+	free_parsed(pipex);
+	pidx_free(pipex);
+	return (sp.status);
+}
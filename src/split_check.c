@@ -0,0 +1,36 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   split_check.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:00:24 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 02:00:24 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+int	split_check(t_pipex *pipex, int ac, char **av)
+{
+	char	buf[PATH_MAX];
+	char	**argv;
+	int		err;
+	int		i;
+
+	i = 1;
+	while (++i < ac - 1)
+	{
+		argv = tokenize_cmd(&pipex->arena, av[i], &err);
+		if (!argv || err || !argv[0] || !argv[0][0])
+			return (-1);
+		if (!pipex->opts.no_builtins && builtin_find(argv) >= 0)
+			continue ;
+		if (access(argv[0], X_OK) == 0)
+			continue ;
+		if (!pipex->paths || !find_command_path(pipex->paths, argv[0], buf))
+			return (-1);
+	}
+	return (0);
+}
@@ -0,0 +1,130 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   split_io.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:12:34 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:12:34 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Copies [off, end) of the infile to stdout, with splice, or
+ * pread and write on a filesystem splice does not support.
+ *
+ * @param in The infile.
+ * @param off Start of the part.
+ * @param end End of the part.
+ * @return 0 on success, -1 on error.
+ */
+static int	chunk_copy(int in, off_t off, off_t end)
+{
+	char	buf[BI_BUF];
+	ssize_t	n;
+
+	n = 1;
+	while (off < end && (n > 0 || (n < 0 && errno == EINTR)))
+		n = splice(in, &off, STDOUT_FILENO, NULL, end - off, SPLICE_F_MOVE);
+	if (off >= end || n == 0)
+		return (0);
+	if (errno != EINVAL && errno != ENOSYS)
+		return (-1);
+	n = 1;
+	while (off < end && n > 0)
+	{
+		n = BI_BUF;
+		if (end - off < n)
+			n = end - off;
+		n = pread(in, buf, n, off);
+		if (n > 0 && bi_write(buf, n) < 0)
+			return (-1);
+		if (n > 0)
+			off += n;
+	}
+	return (-(n < 0));
+}
+
+void	feed_chunk(char *infile, t_pipex *pipex)
+{
+	int	fds[2];
+	int	fd;
+
+	pipex->in_fd = -1;
+	fd = open(infile, O_RDONLY | O_CLOEXEC);
+	if (fd < 0 || pipe2(fds, O_CLOEXEC) < 0)
+	{
+		handle_error(ERR_INFILE);
+		safe_close(&fd);
+		return ;
+	}
+	pipex->heredoc_pid = fork();
+	if (pipex->heredoc_pid == 0)
+	{
+		close(fds[0]);
+		dup2(fds[1], STDOUT_FILENO);
+		exit(chunk_copy(fd, pipex->chunk->start, pipex->chunk->end) < 0);
+	}
+	close(fds[1]);
+	close(fd);
+	pipex->in_fd = fds[0];
+	if (pipex->heredoc_pid < 0)
+		handle_error(ERR_INFILE);
+	if (pipex->heredoc_pid < 0)
+		safe_close(&pipex->in_fd);
+}
+
+/**
+ * @brief Appends, in order, the output of every part whose copy and
+ * earlier parts are done, and closes its anonymous file.
+ *
+ * @param pipex Pointer to the pipex struct, with the outfile open.
+ * @param sp The copies.
+ */
+static void	split_append(t_pipex *pipex, t_split *sp)
+{
+	t_chunk	*part;
+
+	while (sp->done < sp->count && sp->parts[sp->done].status >= 0)
+	{
+		part = &sp->parts[sp->done++];
+		if (part->out >= 0 && part->out != pipex->out_fd
+			&& copy_append(part->out, pipex->out_fd) < 0)
+		{
+			handle_error(ERR_OUTFILE);
+			part->status = 1;
+		}
+		if (part->out != pipex->out_fd)
+			safe_close(&part->out);
+		if (!sp->status)
+			sp->status = part->status;
+	}
+}
+
+int	split_reap(t_pipex *pipex, t_split *sp)
+{
+	t_chunk	*part;
+	pid_t	pid;
+	int		status;
+
+	split_append(pipex, sp);
+	if (sp->done == sp->count)
+		return (0);
+	pid = waitpid(-1, &status, 0);
+	if (pid < 0)
+		return (-(errno != EINTR));
+	part = sp->parts + sp->done;
+	while (part < sp->parts + sp->count
+		&& (part->pid != pid || part->status >= 0))
+		part++;
+	if (part == sp->parts + sp->count)
+		return (0);
+	part->status = WEXITSTATUS(status);
+	if (WIFSIGNALED(status))
+		part->status = 128 + WTERMSIG(status);
+	split_append(pipex, sp);
+	return (0);
+}
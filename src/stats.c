@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:11:01 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 00:56:58 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Returns the value of a "key: value" line of /proc/<pid>/io.
+ *
+ * @param buf Contents of the io file.
+ * @param key Field name, including the trailing ':'.
+ * @return The field value, or -1 if it is missing.
+ */
+static long long	io_field(char *buf, char *key)
+{
+	char	*line;
+
+	line = strstr(buf, key);
+	if (!line)
+		return (-1);
+	return (strtoll(line + ft_strlen(key), NULL, 10));
+}
+
+/**
+ * @brief Reads the I/O counters of a zombie stage from /proc/<pid>/io.
+ *
+ * @param stage Stage record to fill.
+ */
+static void	read_proc_io(t_stage *stage)
+{
+	char	path[64];
+	char	buf[512];
+	int		fd;
+	ssize_t	len;
+
+	snprintf(path, sizeof(path), "/proc/%d/io", stage->pid);
+	fd = open(path, O_RDONLY | O_CLOEXEC);
+	len = -1;
+	if (fd >= 0)
+		len = read(fd, buf, sizeof(buf) - 1);
+	if (fd >= 0)
+		close(fd);
+	if (len < 0)
+		len = 0;
+	buf[len] = '\0';
+	stage->io_rchar = io_field(buf, "rchar:");
+	stage->io_wchar = io_field(buf, "wchar:");
+	stage->io_read_bytes = io_field(buf, "read_bytes:");
+	stage->io_write_bytes = io_field(buf, "\nwrite_bytes:");
+}
+
+t_stage	*find_stage(t_pipex *pipex, pid_t pid)
+{
+	static int	hint;
+	int			i;
+
+	if (!pipex->stages || pid <= 0)
+		return (NULL);
+	i = 0;
+	while (i < pipex->cmd_count)
+	{
+		if (hint >= pipex->cmd_count)
+			hint = 0;
+		if (pipex->stages[hint].pid == pid)
+			return (&pipex->stages[hint]);
+		hint++;
+		i++;
+	}
+	return (NULL);
+}
+
+pid_t	reap_stage(t_pipex *pipex, t_stage *stage, int *status)
+{
+	pid_t	pid;
+
+	if (pipex->opts.stats != STATS_NONE)
+		read_proc_io(stage);
+	pid = wait4(stage->pid, status, 0, &stage->usage);
+	if (pid < 0)
+		return (-1);
+	clock_gettime(CLOCK_MONOTONIC, &stage->end);
+	stage->status = *status;
+	stage->reaped = 1;
+	safe_close(&stage->pipe_rd);
+	return (pid);
+}
+
+pid_t	reap_child(t_pipex *pipex, int *status)
+{
+	siginfo_t	info;
+	t_stage		*stage;
+
+	if (pipex->opts.stats == STATS_NONE)
+		return (waitpid(-1, status, 0));
+	info.si_pid = 0;
+	if (waitid(P_ALL, 0, &info, WEXITED | WNOWAIT) < 0)
+		return (-1);
+	stage = find_stage(pipex, info.si_pid);
+	if (!stage)
+		return (waitpid(info.si_pid, status, 0));
+	return (reap_stage(pipex, stage, status));
+}
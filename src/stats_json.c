@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats_json.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:11:01 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 00:57:20 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Writes a word with JSON string escaping.
+ *
+ * @param fd Descriptor to write to.
+ * @param word Word to escape.
+ */
+static void	json_word(int fd, char *word)
+{
+	unsigned char	c;
+
+	while (*word)
+	{
+		c = (unsigned char)*word++;
+		if (c == '"' || c == '\\')
+			dprintf(fd, "\\%c", c);
+		else if (c < 0x20)
+			dprintf(fd, "\\u%04x", c);
+		else
+			write(fd, &c, 1);
+	}
+}
+
+void	write_command(int fd, char **args, int json)
+{
+	int	i;
+
+	i = 0;
+	while (args && args[i])
+	{
+		if (i > 0)
+			write(fd, " ", 1);
+		if (json)
+			json_word(fd, args[i]);
+		else
+			write(fd, args[i], ft_strlen(args[i]));
+		i++;
+	}
+}
+
+int	stage_exit_code(int status)
+{
+	if (WIFEXITED(status))
+		return (WEXITSTATUS(status));
+	if (WIFSIGNALED(status))
+		return (128 + WTERMSIG(status));
+	return (-1);
+}
+
+/**
+ * @brief Writes one stage (or the total when idx is -1) as a JSON object.
+ *
+ * @param fd Descriptor to write to.
+ * @param st Stage record.
+ * @param idx Stage index, or -1 for the pipeline total.
+ * @param args Stage argument vector, or NULL for the total.
+ */
+static void	print_stage_json(int fd, t_stage *st, int idx, char **args)
+{
+	if (idx >= 0)
+		dprintf(fd, "{\"index\":%d,\"command\":\"", idx);
+	else
+		dprintf(fd, "{\"command\":\"");
+	write_command(fd, args, 1);
+	dprintf(fd, "\",\"pid\":%d,\"exit\":%d,\"wall_ms\":%.3f,"
+		"\"user_ms\":%.3f,\"sys_ms\":%.3f,\"max_rss_kb\":%ld,"
+		"\"voluntary_ctxt_switches\":%ld,\"involuntary_ctxt_switches\":%ld,"
+		"\"rchar\":%lld,\"wchar\":%lld,\"read_bytes\":%lld,"
+		"\"write_bytes\":%lld,\"pipe_bytes\":%d,\"pipe_grows\":%d",
+		st->pid, stage_exit_code(st->status),
+		elapsed_ms(&st->start, &st->end), usage_ms(&st->usage.ru_utime),
+		usage_ms(&st->usage.ru_stime), st->usage.ru_maxrss,
+		st->usage.ru_nvcsw, st->usage.ru_nivcsw, st->io_rchar,
+		st->io_wchar, st->io_read_bytes, st->io_write_bytes, st->pipe_size,
+		st->pipe_grows);
+	if (st->stopped)
+		dprintf(fd, ",\"stopped\":\"%s\"}", stage_stopped(st));
+	else
+		dprintf(fd, ",\"stopped\":null}");
+}
+
+void	print_stats_json(int fd, t_pipex *pipex, t_stage *total)
+{
+	int	i;
+
+	dprintf(fd, "{\"stages\":[");
+	i = 0;
+	while (i < pipex->cmd_count)
+	{
+		if (i > 0)
+			dprintf(fd, ",");
+		print_stage_json(fd, &pipex->stages[i], i, pipex->cmd_args[i]);
+		i++;
+	}
+	dprintf(fd, "],\"total\":");
+	print_stage_json(fd, total, -1, NULL);
+	print_saved(fd, pipex, 1);
+	dprintf(fd, "}\n");
+}
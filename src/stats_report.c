@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats_report.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:11:01 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 00:57:20 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Adds the counters of one stage to the pipeline total.
+ *
+ * @param total Record receiving the total.
+ * @param st Stage record.
+ */
+static void	add_usage(t_stage *total, t_stage *st)
+{
+	timeradd(&total->usage.ru_utime, &st->usage.ru_utime,
+		&total->usage.ru_utime);
+	timeradd(&total->usage.ru_stime, &st->usage.ru_stime,
+		&total->usage.ru_stime);
+	if (st->usage.ru_maxrss > total->usage.ru_maxrss)
+		total->usage.ru_maxrss = st->usage.ru_maxrss;
+	total->usage.ru_nvcsw += st->usage.ru_nvcsw;
+	total->usage.ru_nivcsw += st->usage.ru_nivcsw;
+	total->io_rchar += st->io_rchar;
+	total->io_wchar += st->io_wchar;
+	total->io_read_bytes += st->io_read_bytes;
+	total->io_write_bytes += st->io_write_bytes;
+	total->pipe_size += st->pipe_size;
+	total->pipe_grows += st->pipe_grows;
+}
+
+/**
+ * @brief Accumulates every reaped stage into a pipeline total.
+ *
+ * Wall time spans from the first launch to the last reap, max RSS is the
+ * largest of any stage and every other counter is summed.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param total Record receiving the total.
+ */
+static void	sum_stages(t_pipex *pipex, t_stage *total)
+{
+	t_stage	*st;
+	int		i;
+
+	ft_bzero(total, sizeof(*total));
+	total->start = pipex->stages[0].start;
+	i = -1;
+	while (++i < pipex->cmd_count)
+	{
+		st = &pipex->stages[i];
+		if (elapsed_ms(&st->start, &total->start) > 0)
+			total->start = st->start;
+		if (elapsed_ms(&total->end, &st->end) > 0)
+			total->end = st->end;
+		add_usage(total, st);
+	}
+	total->status = pipex->stages[pipex->cmd_count - 1].status;
+}
+
+/**
+ * @brief Writes one row of the text report.
+ *
+ * @param fd Descriptor to write to.
+ * @param st Stage record.
+ * @param idx Stage index, or -1 for the pipeline total.
+ * @param args Stage argument vector, or NULL for the total.
+ */
+static void	print_stage_text(int fd, t_stage *st, int idx, char **args)
+{
+	if (idx >= 0)
+		dprintf(fd, "%-5d %7d ", idx, st->pid);
+	else
+		dprintf(fd, "%-5s %7s ", "total", "-");
+	dprintf(fd, "%4d %4s %10.3f %10.3f %10.3f %10ld %8ld %8ld %7d %5d "
+		"%12lld %12lld %12lld %12lld  ", stage_exit_code(st->status),
+		stage_stopped(st), elapsed_ms(&st->start, &st->end),
+		usage_ms(&st->usage.ru_utime), usage_ms(&st->usage.ru_stime),
+		st->usage.ru_maxrss, st->usage.ru_nvcsw, st->usage.ru_nivcsw,
+		st->pipe_size / 1024, st->pipe_grows, st->io_rchar, st->io_wchar,
+		st->io_read_bytes, st->io_write_bytes);
+	write_command(fd, args, 0);
+	write(fd, "\n", 1);
+}
+
+/**
+ * @brief Writes the whole report in the text format.
+ *
+ * @param fd Descriptor to write to.
+ * @param pipex Pointer to the pipex struct.
+ * @param total Pipeline total.
+ */
+static void	print_text(int fd, t_pipex *pipex, t_stage *total)
+{
+	int	i;
+
+	dprintf(fd, "%-5s %7s %4s %4s %10s %10s %10s %10s %8s %8s %7s %5s "
+		"%12s %12s %12s %12s  %s\n", "stage", "pid", "exit", "stop",
+		"wall_ms", "user_ms", "sys_ms", "maxrss_kb", "vcsw", "ivcsw",
+		"pipe_kb", "grows", "rchar", "wchar", "read_bytes", "write_bytes",
+		"command");
+	i = 0;
+	while (i < pipex->cmd_count)
+	{
+		print_stage_text(fd, &pipex->stages[i], i, pipex->cmd_args[i]);
+		i++;
+	}
+	print_stage_text(fd, total, -1, NULL);
+	print_saved(fd, pipex, 0);
+}
+
+void	report_stats(t_pipex *pipex)
+{
+	t_stage	total;
+	int		fd;
+
+	if (!pipex->stages || pipex->cmd_count < 1)
+		return ;
+	fd = STDERR_FILENO;
+	if (pipex->opts.stats_file)
+		fd = open(pipex->opts.stats_file,
+				O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0000644);
+	if (fd < 0)
+	{
+		handle_error(pipex->opts.stats_file);
+		return ;
+	}
+	sum_stages(pipex, &total);
+	if (pipex->opts.stats == STATS_JSON)
+		print_stats_json(fd, pipex, &total);
+	else
+		print_text(fd, pipex, &total);
+	if (fd != STDERR_FILENO)
+		close(fd);
+}
@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats_saved.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:49:26 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 00:49:26 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+const char	*stage_stopped(t_stage *stage)
+{
+	const char	*name;
+
+	if (!stage->stopped)
+		return ("-");
+	name = sigabbrev_np(stage->stopped);
+	if (!name)
+		return ("?");
+	return (name);
+}
+
+/**
+ * @brief Returns how many bytes of the infile the first stage never
+ * read, or -1 when that is not known.
+ *
+ * The infile must be a regular file and /proc/<pid>/io must have been
+ * read, so this needs --stats.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @return Bytes left unread.
+ */
+static long long	unread_bytes(t_pipex *pipex)
+{
+	long long	left;
+
+	if (pipex->in_size < 0 || pipex->stages[0].io_rchar < 0)
+		return (-1);
+	left = pipex->in_size - pipex->stages[0].io_rchar;
+	if (left < 0)
+		return (0);
+	return (left);
+}
+
+void	print_saved(int fd, t_pipex *pipex, int json)
+{
+	long long	left;
+	int			stopped;
+	int			i;
+
+	if (pipex->cut_stage < 0)
+		return ;
+	stopped = 0;
+	i = -1;
+	while (++i < pipex->cmd_count)
+		stopped += (pipex->stages[i].stopped != 0);
+	left = unread_bytes(pipex);
+	if (json)
+		dprintf(fd, ",\"short_circuit\":{\"stage\":%d,\"stopped\":%d,"
+			"\"infile_bytes\":%lld,\"unread_bytes\":%lld}",
+			pipex->cut_stage, stopped, (long long)pipex->in_size, left);
+	else if (left >= 0)
+		dprintf(fd, "short-circuit: stage %d exited, %d stage(s) stopped, "
+			"%lld of %lld infile bytes never read\n", pipex->cut_stage,
+			stopped, left, (long long)pipex->in_size);
+	else
+		dprintf(fd, "short-circuit: stage %d exited, %d stage(s) stopped\n",
+			pipex->cut_stage, stopped);
+}
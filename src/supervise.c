@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   supervise.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:49:26 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:55:48 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Creates the epoll instance and the timerfd, and opens a pidfd
+ * for every launched stage.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param sv The supervisor to fill.
+ * @return 0 on success, -1 if a stage could not be watched.
+ */
+static int	sv_open(t_pipex *pipex, t_super *sv)
+{
+	struct epoll_event	ev;
+	t_stage				*st;
+	int					i;
+
+	sv->ep = epoll_create1(EPOLL_CLOEXEC);
+	sv->tfd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+	ev.events = EPOLLIN;
+	ev.data.u32 = pipex->cmd_count;
+	if (sv->ep < 0 || sv->tfd < 0
+		|| epoll_ctl(sv->ep, EPOLL_CTL_ADD, sv->tfd, &ev) < 0)
+		return (-1);
+	i = -1;
+	while (++i < pipex->cmd_count)
+	{
+		st = &pipex->stages[i];
+		if (st->pid <= 0 || st->reaped)
+			continue ;
+		st->pidfd = pidfd_open(st->pid, 0);
+		ev.data.u32 = i;
+		if (st->pidfd < 0
+			|| epoll_ctl(sv->ep, EPOLL_CTL_ADD, st->pidfd, &ev) < 0)
+			return (-1);
+		sv->live++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Closes the epoll instance, the timerfd, and the pidfds and
+ * pipe read ends still open.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param sv The supervisor.
+ */
+static void	sv_close(t_pipex *pipex, t_super *sv)
+{
+	int	i;
+
+	i = -1;
+	while (++i < pipex->cmd_count)
+	{
+		safe_close(&pipex->stages[i].pidfd);
+		safe_close(&pipex->stages[i].pipe_rd);
+	}
+	if (sv->tfd >= 0)
+		close(sv->tfd);
+	if (sv->ep >= 0)
+		close(sv->ep);
+}
+
+void	supervise_event(t_pipex *pipex, t_super *sv, int i, int *last)
+{
+	t_stage	*st;
+	int		status;
+
+	if (i == pipex->cmd_count)
+		return ;
+	st = &pipex->stages[i];
+	safe_close(&st->pidfd);
+	sv->live--;
+	if (reap_stage(pipex, st, &status) < 0)
+		return ;
+	if (WIFEXITED(status) && pipex->pid == st->pid)
+		*last = WEXITSTATUS(status);
+	stop_heredoc_feeder(pipex, st->pid);
+	while (pipex->opts.short_circuit && --i >= 0)
+	{
+		if (pipex->stages[i].pid <= 0 || pipex->stages[i].reaped
+			|| pipex->stages[i].stopped)
+			continue ;
+		if (pipex->cut_stage < 0)
+			pipex->cut_stage = st - pipex->stages;
+		stage_signal(&pipex->stages[i], SIGPIPE, pipex->opts.grace_ms);
+	}
+}
+
+/**
+ * @brief Arms the timerfd for the next signal that is due, or disarms
+ * it; either way its expiration count goes back to zero.
+ *
+ * @param sv The supervisor.
+ * @param pending 1 if sv->next holds a deadline.
+ */
+static void	sv_arm(t_super *sv, int pending)
+{
+	struct itimerspec	its;
+
+	ft_bzero(&its, sizeof(its));
+	if (pending)
+		its.it_value = sv->next;
+	timerfd_settime(sv->tfd, TFD_TIMER_ABSTIME, &its, NULL);
+}
+
+int	supervise(t_pipex *pipex, int last)
+{
+	struct epoll_event	ev[SV_EVENTS];
+	t_super				sv;
+	int					n;
+
+	if (!pipex->stages || pipex->cmd_count < 1)
+		return (last);
+	ft_bzero(&sv, sizeof(sv));
+	supervise_deadlines(pipex, &sv);
+	if (sv_open(pipex, &sv) < 0)
+	{
+		handle_error("Supervisor setup failed, waiting without pidfds");
+		supervise_wait(pipex, &sv, &last);
+	}
+	while (sv.live > 0)
+	{
+		sv_arm(&sv, supervise_due(pipex, &sv));
+		n = epoll_wait(sv.ep, ev, SV_EVENTS, -1);
+		while (n-- > 0)
+			supervise_event(pipex, &sv, ev[n].data.u32, &last);
+	}
+	sv_close(pipex, &sv);
+	report_timeouts(pipex);
+	if (sv.timed_out)
+		return (TIMEOUT_EXIT);
+	return (last);
+}
@@ -0,0 +1,78 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   supervise_timeout.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:53:55 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 00:53:55 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+long long	stage_timeout(t_pipex *pipex, int i)
+{
+	t_stagetmo	*tmo;
+	long long	all;
+	long long	own;
+	int			k;
+
+	all = 0;
+	own = -1;
+	k = -1;
+	while (++k < pipex->opts.stage_tmo_count)
+	{
+		tmo = &pipex->opts.stage_tmo[k];
+		if (tmo->stage == i + 1)
+			own = tmo->ms;
+		else if (tmo->stage == 0)
+			all = tmo->ms;
+	}
+	if (own >= 0)
+		return (own);
+	return (all);
+}
+
+void	supervise_deadlines(t_pipex *pipex, t_super *sv)
+{
+	t_stage		*st;
+	long long	ms;
+	int			i;
+
+	if (pipex->opts.timeout_ms > 0)
+		deadline_ms(&sv->deadline, pipex->opts.timeout_ms);
+	i = -1;
+	while (++i < pipex->cmd_count)
+	{
+		st = &pipex->stages[i];
+		ms = stage_timeout(pipex, i);
+		if (ms <= 0 || st->pid <= 0)
+			continue ;
+		st->deadline = st->start;
+		ts_add_ms(&st->deadline, ms);
+	}
+}
+
+void	report_timeouts(t_pipex *pipex)
+{
+	t_stage	*st;
+	int		i;
+
+	i = -1;
+	while (++i < pipex->cmd_count)
+	{
+		st = &pipex->stages[i];
+		if (st->timed_out == TIMEOUT_STAGE)
+			dprintf(STDERR_FILENO, "%scommand %d after %.3f s: ",
+				ERR_TIMEOUT, i + 1, stage_timeout(pipex, i) / 1e3);
+		else if (st->timed_out == TIMEOUT_PIPELINE)
+			dprintf(STDERR_FILENO, "%scommand %d, pipeline limit of "
+				"%.3f s: ", ERR_TIMEOUT, i + 1, pipex->opts.timeout_ms / 1e3);
+		else
+			continue ;
+		write_command(STDERR_FILENO, pipex->cmd_args[i], 0);
+		write(STDERR_FILENO, "\n", 1);
+	}
+}
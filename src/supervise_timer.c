@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   supervise_timer.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:53:55 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 00:56:58 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Checks whether a deadline is set and has passed.
+ *
+ * @param at The deadline, zero when unset.
+ * @param now The current time.
+ * @return 1 if it is due, 0 otherwise.
+ */
+static int	ts_due(struct timespec *at, struct timespec *now)
+{
+	return ((at->tv_sec || at->tv_nsec) && elapsed_ms(at, now) >= 0);
+}
+
+/**
+ * @brief Makes a deadline the next timer expiry if it comes first.
+ *
+ * @param sv The supervisor.
+ * @param at The deadline, ignored when zero.
+ * @param pending 1 once sv->next holds a deadline; set here.
+ */
+static void	ts_min(t_super *sv, struct timespec *at, int *pending)
+{
+	if (!at->tv_sec && !at->tv_nsec)
+		return ;
+	if (!*pending || elapsed_ms(at, &sv->next) > 0)
+		sv->next = *at;
+	*pending = 1;
+}
+
+void	stage_signal(t_stage *stage, int sig, long long ms)
+{
+	kill(stage->pid, sig);
+	stage->stopped = sig;
+	deadline_ms(&stage->kill_at, ms);
+}
+
+/**
+ * @brief Sends a stage the signal that is due for it, if any.
+ *
+ * SIGPIPE escalates to SIGTERM and SIGTERM to SIGKILL. A stage nothing
+ * was sent to yet gets SIGTERM once the pipeline or its own deadline
+ * has passed.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @param sv The supervisor.
+ * @param st The stage, still running.
+ * @param now The current time.
+ */
+static void	sv_fire(t_pipex *pipex, t_super *sv, t_stage *st,
+	struct timespec *now)
+{
+	if (st->stopped == SIGPIPE && ts_due(&st->kill_at, now))
+		stage_signal(st, SIGTERM, pipex->opts.kill_ms);
+	else if (st->stopped == SIGTERM && ts_due(&st->kill_at, now))
+		stage_signal(st, SIGKILL, 0);
+	if (st->stopped)
+		return ;
+	if (ts_due(&sv->deadline, now))
+		st->timed_out = TIMEOUT_PIPELINE;
+	else if (ts_due(&st->deadline, now))
+		st->timed_out = TIMEOUT_STAGE;
+	if (!st->timed_out)
+		return ;
+	stage_signal(st, SIGTERM, pipex->opts.kill_ms);
+	if (st->timed_out == TIMEOUT_PIPELINE || st->pid == pipex->pid)
+		sv->timed_out = 1;
+}
+
+int	supervise_due(t_pipex *pipex, t_super *sv)
+{
+	struct timespec	now;
+	t_stage			*st;
+	int				pending;
+	int				i;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	pending = 0;
+	i = -1;
+	while (++i < pipex->cmd_count)
+	{
+		st = &pipex->stages[i];
+		if (st->pid <= 0 || st->reaped)
+			continue ;
+		sv_fire(pipex, sv, st, &now);
+		if (st->stopped == SIGPIPE || st->stopped == SIGTERM)
+			ts_min(sv, &st->kill_at, &pending);
+		else if (!st->stopped)
+		{
+			ts_min(sv, &st->deadline, &pending);
+			ts_min(sv, &sv->deadline, &pending);
+		}
+	}
+	if (pipex->opts.pipe_auto && pipe_sample(pipex, &sv->sample_at, &now))
+		ts_min(sv, &sv->sample_at, &pending);
+	return (pending);
+}
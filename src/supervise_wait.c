@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   supervise_wait.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:52:34 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:55:48 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Does nothing; SIGCHLD and SIGALRM only end sigsuspend.
+ *
+ * @param sig The signal.
+ */
+static void	sv_wake(int sig)
+{
+	(void)sig;
+}
+
+/**
+ * @brief Installs or removes the wake-up handler for SIGCHLD and
+ * SIGALRM, which stay blocked outside sigsuspend.
+ *
+ * @param on 1 to install, 0 to restore the defaults and old mask.
+ * @param old Receives, or gives back, the signal mask before.
+ */
+static void	sv_signals(int on, sigset_t *old)
+{
+	struct sigaction	sa;
+	struct itimerval	it;
+	sigset_t			mask;
+
+	ft_bzero(&sa, sizeof(sa));
+	sa.sa_handler = SIG_DFL;
+	if (on)
+		sa.sa_handler = sv_wake;
+	sigemptyset(&mask);
+	sigaddset(&mask, SIGCHLD);
+	sigaddset(&mask, SIGALRM);
+	if (on)
+		sigprocmask(SIG_BLOCK, &mask, old);
+	sigaction(SIGCHLD, &sa, NULL);
+	sigaction(SIGALRM, &sa, NULL);
+	if (on)
+		return ;
+	ft_bzero(&it, sizeof(it));
+	setitimer(ITIMER_REAL, &it, NULL);
+	sigprocmask(SIG_SETMASK, old, NULL);
+}
+
+/**
+ * @brief Finds a stage that has ended, without reaping it.
+ *
+ * @param pipex Pointer to the pipex struct.
+ * @return Its index, -1 if every stage left is running, -2 if none is.
+ */
+static int	sv_ended(t_pipex *pipex)
+{
+	siginfo_t	info;
+	t_stage		*st;
+	int			ret;
+	int			i;
+
+	ret = -2;
+	i = -1;
+	while (++i < pipex->cmd_count)
+	{
+		st = &pipex->stages[i];
+		if (st->pid <= 0 || st->reaped)
+			continue ;
+		ret = -1;
+		info.si_pid = 0;
+		if (waitid(P_PID, st->pid, &info, WEXITED | WNOHANG | WNOWAIT) < 0)
+			st->reaped = 1;
+		else if (info.si_pid)
+			return (i);
+	}
+	return (ret);
+}
+
+/**
+ * @brief Sets SIGALRM to come when sv->next is due, or cancels it.
+ *
+ * @param sv The supervisor.
+ * @param pending 1 if sv->next holds a deadline.
+ */
+static void	sv_alarm(t_super *sv, int pending)
+{
+	struct itimerval	it;
+	struct timespec		now;
+	long long			ms;
+
+	ft_bzero(&it, sizeof(it));
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	ms = elapsed_ms(&now, &sv->next) + 1;
+	if (ms < 1)
+		ms = 1;
+	if (pending)
+	{
+		it.it_value.tv_sec = ms / 1000;
+		it.it_value.tv_usec = ms % 1000 * 1000;
+	}
+	setitimer(ITIMER_REAL, &it, NULL);
+}
+
+void	supervise_wait(t_pipex *pipex, t_super *sv, int *last)
+{
+	sigset_t	old;
+	int			i;
+
+	sv_signals(1, &old);
+	i = sv_ended(pipex);
+	while (i != -2)
+	{
+		if (i >= 0)
+			supervise_event(pipex, sv, i, last);
+		else
+		{
+			sv_alarm(sv, supervise_due(pipex, sv));
+			sigsuspend(&old);
+		}
+		i = sv_ended(pipex);
+	}
+	sv->live = 0;
+	sv_signals(0, &old);
+}
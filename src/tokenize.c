@@ -0,0 +1,134 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tokenize.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: dancuenc <dancuenc@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:22:13 by dancuenc          #+#    #+#             */
+/*   Updated: 2026/10/18 01:27:15 by dancuenc         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../include/pipex.h"
+
+/**
+ * @brief Checks whether c separates arguments outside quotes.
+ *
+ * @param c The character to check.
+ * @return 1 for space, tab or newline, 0 otherwise.
+ */
+static int	is_blank(char c)
+{
+	return (c == ' ' || c == '\t' || c == '\n');
+}
+
+/**
+ * @brief Copies a quoted section into the current argument.
+ *
+ * Inside single quotes every byte is literal. Inside double quotes a
+ * backslash only escapes $, `, ", \ and newline, as in sh.
+ *
+ * @param s Points at the opening quote.
+ * @param out Write cursor of the current argument.
+ * @return The byte after the closing quote, or NULL if there is none.
+ */
+static const char	*tok_quoted(const char *s, char **out)
+{
+	char	quote;
+
+	quote = *s++;
+	while (*s && *s != quote)
+	{
+		if (quote == '"' && s[0] == '\\' && s[1] == '\n')
+		{
+			s += 2;
+			continue ;
+		}
+		if (quote == '"' && s[0] == '\\' && s[1]
+			&& ft_strchr("$`\"\\", s[1]))
+			s++;
+		*(*out)++ = *s++;
+	}
+	if (!*s)
+		return (NULL);
+	return (s + 1);
+}
+
+/**
+ * @brief Copies one argument, up to the next unquoted blank.
+ *
+ * Outside quotes a backslash keeps the next byte literal, and a
+ * backslash-newline pair is dropped.
+ *
+ * @param s Start of the argument.
+ * @param out Write cursor of the current argument.
+ * @return The byte after the argument, or NULL on an unterminated quote.
+ */
+static const char	*tok_word(const char *s, char **out)
+{
+	while (s && *s && !is_blank(*s))
+	{
+		if (*s == '\'' || *s == '"')
+			s = tok_quoted(s, out);
+		else if (s[0] == '\\' && s[1] == '\n')
+			s += 2;
+		else if (s[0] == '\\' && s[1])
+		{
+			*(*out)++ = s[1];
+			s += 2;
+		}
+		else
+			*(*out)++ = *s++;
+	}
+	return (s);
+}
+
+/**
+ * @brief Splits cmd into arguments written one after another at *out.
+ *
+ * @param cmd The command string.
+ * @param argv Receives a pointer to each argument.
+ * @param out Write cursor, left past the last argument's NUL.
+ * @return The number of arguments, or -1 on an unterminated quote.
+ */
+static int	tok_split(const char *cmd, char **argv, char **out)
+{
+	int	argc;
+
+	argc = 0;
+	while (cmd)
+	{
+		while (is_blank(*cmd))
+			cmd++;
+		if (!*cmd)
+			break ;
+		argv[argc++] = *out;
+		cmd = tok_word(cmd, out);
+		*(*out)++ = '\0';
+	}
+	if (!cmd)
+		return (-1);
+	return (argc);
+}
+
+char	**tokenize_cmd(t_arena *arena, const char *cmd, int *err)
+{
+	char	**argv;
+	char	*out;
+	size_t	len;
+	int		argc;
+
+	len = ft_strlen(cmd);
+	argv = arena_alloc(arena, sizeof(char *) * (len / 2 + 2) + len * 2 + 2);
+	if (!argv)
+		return (NULL);
+	out = (char *)(argv + len / 2 + 2);
+	argc = tok_split(cmd, argv, &out);
+	*err = (argc < 0);
+	if (*err)
+		argc = 0;
+	argv[argc] = NULL;
+	arena_shrink(arena, argv, out);
+	return (argv);
+}